@@ -0,0 +1,78 @@
+// Copyright ii887522
+
+#include "AssetLoader.h"
+#include <functional>
+#include <queue>
+#include <thread>  // NOLINT(build/c++11)
+#include <mutex>  // NOLINT(build/c++11)
+#include <condition_variable>  // NOLINT(build/c++11)
+
+using std::function;
+using std::queue;
+using std::thread;
+using std::mutex;
+using std::lock_guard;
+using std::unique_lock;
+using std::condition_variable;
+
+namespace ii887522::snake {
+
+AssetLoader::AssetLoader() : pendingCount{ 0u }, isStopping{ false }, worker{ [this]() { run(); } } { }
+
+void AssetLoader::run() {
+  while (true) {
+    function<function<void(bool)>()> job;
+    {
+      unique_lock l_lock{ lock };
+      jobCondition.wait(l_lock, [this]() { return isStopping || !jobs.empty(); });
+      if (isStopping) return;
+      job = jobs.front();
+      jobs.pop();
+    }
+    const auto l_upload{ job() };
+    const lock_guard l_lock{ lock };
+    uploads.push(l_upload);
+  }
+}
+
+void AssetLoader::load(const function<function<void(bool)>()>& load) {
+  {
+    const lock_guard l_lock{ lock };
+    jobs.push(load);
+    ++pendingCount;
+  }
+  jobCondition.notify_one();
+}
+
+void AssetLoader::upload(const unsigned int maxCount) {
+  for (auto i{ 0u }; i != maxCount; ++i) {
+    function<void(bool)> l_upload;
+    {
+      const lock_guard l_lock{ lock };
+      if (uploads.empty()) return;
+      l_upload = uploads.front();
+      uploads.pop();
+    }
+    l_upload(true);
+    const lock_guard l_lock{ lock };
+    --pendingCount;
+  }
+}
+
+bool AssetLoader::isIdle() {
+  const lock_guard l_lock{ lock };
+  return pendingCount == 0u;
+}
+
+AssetLoader::~AssetLoader() {
+  {
+    const lock_guard l_lock{ lock };
+    isStopping = true;
+  }
+  jobCondition.notify_one();
+  worker.join();
+  // The worker has stopped, so nothing else touches the uploads any more
+  for (; !uploads.empty(); uploads.pop()) uploads.front()(false);
+}
+
+}  // namespace ii887522::snake
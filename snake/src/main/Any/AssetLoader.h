@@ -0,0 +1,62 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_ASSETLOADER_H_
+#define SNAKE_SRC_MAIN_ANY_ASSETLOADER_H_
+
+#include <functional>
+#include <queue>
+#include <thread>  // NOLINT(build/c++11)
+#include <mutex>  // NOLINT(build/c++11)
+#include <condition_variable>  // NOLINT(build/c++11)
+
+using std::function;
+using std::queue;
+using std::thread;
+using std::mutex;
+using std::condition_variable;
+
+namespace ii887522::snake {
+
+// It decodes and rasterizes assets on a background thread into CPU-side buffers, then hands each of them back to the main thread
+// to be uploaded into textures a few at a time per frame, so loading assets never stalls a frame.
+// Thread Safe: load() can be called from any thread. upload() and isIdle() must only be called in main thread.
+class AssetLoader final {
+  // remove copy semantics
+  AssetLoader(const AssetLoader&) = delete;
+  AssetLoader& operator=(const AssetLoader&) = delete;
+
+  // remove move semantics
+  AssetLoader(AssetLoader&&) = delete;
+  AssetLoader& operator=(AssetLoader&&) = delete;
+
+  mutex lock;  // it guards everything below except worker
+  condition_variable jobCondition;
+  queue<function<function<void(bool)>()>> jobs;
+  queue<function<void(bool)>> uploads;
+  unsigned int pendingCount;  // the number of assets loaded or being loaded but not uploaded yet
+  bool isStopping;
+  thread worker;
+
+  void run();
+
+ public:
+  explicit AssetLoader();
+
+  // Param load: it runs on the background thread and must not touch the renderer. It returns a function which runs in main thread
+  //   to upload what it has loaded if it is given true, or only to free what it has loaded if the loader is destroyed before that
+  //   and it is given false.
+  void load(const function<function<void(bool)>()>& load);
+
+  // Runs at most maxCount uploads of the assets which have been loaded.
+  void upload(const unsigned int maxCount);
+
+  // Return: whether every asset given has been loaded and uploaded
+  bool isIdle();
+
+  // It stops after the asset being loaded. The assets loaded but not uploaded yet are freed, the rest are discarded.
+  ~AssetLoader();
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_ASSETLOADER_H_
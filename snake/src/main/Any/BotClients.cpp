@@ -0,0 +1,133 @@
+// Copyright ii887522
+
+#include "BotClients.h"
+#include <winsock2.h>
+#include <vector>
+#include <atomic>
+#include <cstdio>
+#include <algorithm>
+#include <stdexcept>
+#include <chrono>  // NOLINT(build/c++11)
+#include "Enums.h"
+#include "GameServer.h"
+#include "../Functions/buffer_ext.h"
+#include "../Functions/random_ext.h"
+
+using std::vector;
+using std::printf;
+using std::max;
+using std::runtime_error;
+using std::chrono::steady_clock;
+using std::chrono::milliseconds;
+using std::chrono::duration_cast;
+
+namespace ii887522::snake {
+
+BotClients::BotClients(const unsigned short port, const unsigned int count, const unsigned long long seed) : isStopping{ false },
+  randomState{ seed }, stateCount{ 0ull }, deltaCount{ 0ull } {
+  sockaddr_in address{ };
+  address.sin_family = AF_INET;
+  address.sin_port = htons(port);
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  for (auto i{ 0u }; i != count; ++i) {
+    const auto l_socket{ socket(AF_INET, SOCK_STREAM, IPPROTO_TCP) };
+    if (l_socket == INVALID_SOCKET) throw runtime_error{ "Failed to create a bot socket!" };
+    if (connect(l_socket, reinterpret_cast<const sockaddr*>(&address), sizeof address) == SOCKET_ERROR) {
+      closesocket(l_socket);
+      throw runtime_error{ "Failed to connect a bot to the server!" };
+    }
+    u_long isNonBlocking{ 1u };
+    const char isNoDelay{ 1 };
+    ioctlsocket(l_socket, FIONBIO, &isNonBlocking);
+    setsockopt(l_socket, IPPROTO_TCP, TCP_NODELAY, &isNoDelay, sizeof isNoDelay);
+    bots.push_back(Bot{ l_socket, vector<char>{ }, false });
+    pollFds.push_back(WSAPOLLFD{ l_socket, POLLRDNORM, 0 });
+  }
+}
+
+unsigned int BotClients::getMessageSize(const char*const data, const unsigned int size) {
+  constexpr auto stateHeaderSize{ 13u };  // type, width, height, tick and body length
+  constexpr auto deltaSize{ 10u };  // type, tick, head and flags
+  if (size == 0u) return 0u;
+  if (static_cast<ServerMessageType>(data[0u]) == ServerMessageType::DELTA) {
+    if (size < deltaSize) return 0u;
+    const auto l_deltaSize{ deltaSize + (data[deltaSize - 1u] & GameServer::DELTA_FOOD ? 4u : 0u) };
+    return size < l_deltaSize ? 0u : l_deltaSize;
+  }
+  if (size < stateHeaderSize) return 0u;
+  auto bodyLengthData{ data + stateHeaderSize - 4u };
+  const auto stateSize{ stateHeaderSize + (readLittleEndian<unsigned int>(&bodyLengthData) << 2u) + 5u };
+  return size < stateSize ? 0u : stateSize;
+}
+
+bool BotClients::receive(Bot& bot) {
+  char buffer[4096u];
+  while (true) {
+    const auto size{ recv(bot.socket, buffer, sizeof buffer, 0) };
+    if (size == SOCKET_ERROR) {
+      if (WSAGetLastError() != WSAEWOULDBLOCK) return false;
+      break;
+    }
+    if (size == 0) return false;
+    bot.inbox.insert(bot.inbox.end(), buffer, buffer + size);
+  }
+  auto offset{ 0u };
+  while (true) {
+    const auto message{ bot.inbox.data() + offset };
+    const auto messageSize{ getMessageSize(message, static_cast<unsigned int>(bot.inbox.size()) - offset) };
+    if (messageSize == 0u) break;
+    const auto type{ static_cast<ServerMessageType>(message[0u]) };
+    if (type == ServerMessageType::STATE) {
+      ++stateCount;
+      bot.isDead = false;
+    } else if (type == ServerMessageType::DELTA) {
+      ++deltaCount;
+      if (message[9u] & GameServer::DELTA_DEAD) bot.isDead = true;
+    } else {
+      return false;
+    }
+    offset += messageSize;
+  }
+  bot.inbox.erase(bot.inbox.begin(), bot.inbox.begin() + offset);
+  return true;
+}
+
+void BotClients::run() {
+  auto nextTickTime{ steady_clock::now() + milliseconds{ TICK_DURATION } };
+  auto nextReportTime{ steady_clock::now() + milliseconds{ REPORT_INTERVAL } };
+  while (!isStopping && !bots.empty()) {
+    const auto timeout{ max(duration_cast<milliseconds>(nextTickTime - steady_clock::now()), milliseconds{ 0 }).count() };
+    WSAPoll(pollFds.data(), static_cast<unsigned long>(pollFds.size()), static_cast<int>(timeout));
+    for (auto i{ static_cast<unsigned int>(bots.size()) }; i-- != 0u; ) {
+      if (pollFds[i].revents == 0) continue;
+      pollFds[i].revents = 0;
+      if (receive(bots[i])) continue;
+      closesocket(bots[i].socket);
+      bots[i] = bots.back();
+      bots.pop_back();
+      pollFds[i] = pollFds.back();
+      pollFds.pop_back();
+    }
+    if (steady_clock::now() < nextTickTime) continue;
+    nextTickTime += milliseconds{ TICK_DURATION };
+    for (const auto& bot : bots) {
+      const auto command{
+        bot.isDead ? ClientCommand::RESTART : static_cast<ClientCommand>(nextRandom(&randomState, static_cast<unsigned int>(Direction::COUNT)))
+      };
+      send(bot.socket, reinterpret_cast<const char*>(&command), sizeof command, 0);
+    }
+    if (steady_clock::now() < nextReportTime) continue;
+    nextReportTime += milliseconds{ REPORT_INTERVAL };
+    printf("bots %u  states %llu  deltas %llu\n", static_cast<unsigned int>(bots.size()), stateCount, deltaCount);
+  }
+}
+
+void BotClients::stop() {
+  isStopping = true;
+}
+
+BotClients::~BotClients() {
+  for (const auto& bot : bots) closesocket(bot.socket);
+}
+
+}  // namespace ii887522::snake
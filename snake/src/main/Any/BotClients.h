@@ -0,0 +1,70 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_BOTCLIENTS_H_
+#define SNAKE_SRC_MAIN_ANY_BOTCLIENTS_H_
+
+#include <winsock2.h>
+#include <vector>
+#include <atomic>
+
+using std::vector;
+using std::atomic;
+
+namespace ii887522::snake {
+
+// It plays many games on a game server at once by turning at random, so that the server can be loaded without real players. The
+// messages received are parsed to make sure they are well formed.
+// See also GameServer.h for more details
+// Not Thread Safe: only stop() may be called from another thread
+class BotClients final {
+  // remove copy semantics
+  BotClients(const BotClients&) = delete;
+  BotClients& operator=(const BotClients&) = delete;
+
+  // remove move semantics
+  BotClients(BotClients&&) = delete;
+  BotClients& operator=(BotClients&&) = delete;
+
+  static constexpr auto TICK_DURATION{ 62u };  // in milliseconds
+  static constexpr auto REPORT_INTERVAL{ 1000u };  // in milliseconds
+
+  struct Bot final {
+    SOCKET socket;
+    vector<char> inbox;  // the bytes received which do not make up a whole message yet
+    bool isDead;
+  };
+
+  atomic<bool> isStopping;
+  unsigned long long randomState;
+  vector<Bot> bots;
+  vector<WSAPOLLFD> pollFds;  // in the same order as bots
+  unsigned long long stateCount;  // the number of STATE messages received
+  unsigned long long deltaCount;  // the number of DELTA messages received
+
+  // Return: false if the bot has received a message which is not well formed, true otherwise
+  bool receive(Bot&);
+
+  // Param data: it points to the beginning of a message
+  // Param size: the number of bytes received from data onward
+  // Return: the size of the message, or 0 if it has not been received completely
+  static unsigned int getMessageSize(const char*const data, const unsigned int size);
+
+ public:
+  // Param port: the port which the server listens on this machine
+  // Param count: the number of games played at once
+  // Param seed: it decides where the bots turn
+  explicit BotClients(const unsigned short port, const unsigned int count, const unsigned long long seed);
+
+  // Plays until stop() is called or the server disconnects every bot. The message counts are printed every second.
+  void run();
+
+  // It makes run() return within 1 tick.
+  // Thread Safe
+  void stop();
+
+  ~BotClients();
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_BOTCLIENTS_H_
@@ -0,0 +1,50 @@
+// Copyright ii887522
+
+#include "Canvas.h"
+#include <Struct/Color.h>
+#include <SDL.h>
+#include <algorithm>
+
+using std::fill_n;
+using ii887522::viewify::Color;
+
+namespace ii887522::snake {
+
+Canvas::Canvas(SDL_Renderer*const renderer, SDL_Surface*const surface) : renderer{ renderer }, surface{ surface },
+  clip{ 0, 0, surface ? surface->w : 0, surface ? surface->h : 0 } { }
+
+void Canvas::setClip(const SDL_Rect& value) {
+  if (!surface) {
+    SDL_RenderSetClipRect(renderer, &value);
+    return;
+  }
+  const SDL_Rect surfaceRect{ 0, 0, surface->w, surface->h };
+  if (!SDL_IntersectRect(&value, &surfaceRect, &clip)) clip = SDL_Rect{ 0, 0, 0, 0 };
+}
+
+void Canvas::clearClip() {
+  if (!surface) {
+    SDL_RenderSetClipRect(renderer, nullptr);
+    return;
+  }
+  clip = SDL_Rect{ 0, 0, surface->w, surface->h };
+}
+
+void Canvas::fillRects(const SDL_Rect*const rects, const int count, const Color<unsigned int>& color) {
+  if (!surface) {
+    SDL_SetRenderDrawColor(renderer, static_cast<Uint8>(color.r), static_cast<Uint8>(color.g), static_cast<Uint8>(color.b),
+      static_cast<Uint8>(color.a));
+    SDL_RenderFillRects(renderer, rects, count);
+    return;
+  }
+  const auto pixel{ static_cast<Uint32>(color.a << 24u | color.r << 16u | color.g << 8u | color.b) };
+  for (auto i{ 0 }; i != count; ++i) {
+    SDL_Rect rect;
+    if (!SDL_IntersectRect(&rects[i], &clip, &rect)) continue;
+    auto row{ reinterpret_cast<Uint8*>(surface->pixels) + rect.y * surface->pitch + (rect.x << 2u) };
+    // Filling a whole row at once lets the compiler write several pixels per instruction
+    for (auto y{ 0 }; y != rect.h; ++y, row += surface->pitch) fill_n(reinterpret_cast<Uint32*>(row), rect.w, pixel);
+  }
+}
+
+}  // namespace ii887522::snake
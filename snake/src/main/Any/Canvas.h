@@ -0,0 +1,49 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_CANVAS_H_
+#define SNAKE_SRC_MAIN_ANY_CANVAS_H_
+
+#include <Struct/Color.h>
+#include <SDL.h>
+
+using ii887522::viewify::Color;
+
+namespace ii887522::snake {
+
+// It fills rectangles either through a renderer or straight into the pixels of a surface, so that the same drawing code works
+// with both. Filling a surface writes each row of a rectangle as 1 span of pixels without going through the renderer at all.
+// Not Thread Safe
+class Canvas final {
+  // remove copy semantics
+  Canvas(const Canvas&) = delete;
+  Canvas& operator=(const Canvas&) = delete;
+
+  // remove move semantics
+  Canvas(Canvas&&) = delete;
+  Canvas& operator=(Canvas&&) = delete;
+
+  SDL_Renderer*const renderer;
+  SDL_Surface*const surface;  // the renderer is used instead if it is nullptr
+  SDL_Rect clip;  // the region of the surface which can be filled
+
+ public:
+  // Param renderer: it must not be assigned to integer
+  // Param surface: if it is not nullptr, it is filled instead of the current render target of the renderer. Its pixel format
+  //   must be SDL_PIXELFORMAT_ARGB8888.
+  explicit Canvas(SDL_Renderer*const renderer, SDL_Surface*const surface = nullptr);
+
+  // Param value: nothing outside of it is filled until it is cleared
+  void setClip(const SDL_Rect& value);
+
+  void clearClip();
+
+  void fillRects(const SDL_Rect*const rects, const int count, const Color<unsigned int>&);
+
+  void fillRect(const SDL_Rect& rect, const Color<unsigned int>& color) {
+    fillRects(&rect, 1, color);
+  }
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_CANVAS_H_
@@ -0,0 +1,85 @@
+// Copyright ii887522
+
+#include "CellGrid.h"
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <vector>
+#include "Enums.h"
+#include "Level.h"
+#include "../Struct/MemoryUsage.h"
+#include "../Functions/accounting.h"
+#include "../Functions/random_ext.h"
+
+using std::vector;
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+CellGrid::CellGrid(const Size<unsigned int>& size, const Level*const level) : size{ size }, level{ level },
+  chunkColumnCount{ (size.w + CHUNK_SIDE - 1u) / CHUNK_SIDE },
+  chunks(chunkColumnCount * ((size.h + CHUNK_SIDE - 1u) / CHUNK_SIDE), nullptr), chunkCount{ 0u } { }
+
+CellType CellGrid::get(const Point<unsigned int>& position) const {
+  if (isWall(position)) return CellType::WALL;
+  const auto chunk{ chunks[getChunkIndex(position)] };
+  return chunk ? static_cast<CellType>(chunk->cells[getCellIndex(position)]) : CellType::BACKGROUND;
+}
+
+void CellGrid::set(const Point<unsigned int>& position, const CellType value) {
+  if (isWall(position)) return;
+  auto& chunk{ chunks[getChunkIndex(position)] };
+  if (!chunk) {
+    if (value == CellType::BACKGROUND) return;
+    chunk = new Chunk{ };
+    ++chunkCount;
+    trackAllocation(MemoryCategory::BOARD_MAP, MemoryUsage{ sizeof(Chunk), 1ll });
+  }
+  auto& cell{ chunk->cells[getCellIndex(position)] };
+  const auto prevValue{ static_cast<CellType>(cell) };
+  if (prevValue == value) return;
+  if (prevValue == CellType::BACKGROUND) ++chunk->usedCount;
+  else if (value == CellType::BACKGROUND) --chunk->usedCount;
+  cell = static_cast<unsigned char>(value);
+  if (chunk->usedCount != 0u) return;
+  delete chunk;
+  chunk = nullptr;
+  --chunkCount;
+  trackFree(MemoryCategory::BOARD_MAP, MemoryUsage{ sizeof(Chunk), 1ll });
+}
+
+Point<unsigned int> CellGrid::getRandomBackgroundCell(unsigned long long*const randomState) const {
+  const Size innerSize{ size.w - 2u, size.h - 2u };
+  // Most of the board is usually empty, so a few guesses are nearly always enough
+  for (auto i{ 0u }; i != 64u; ++i) {
+    const Point position{ nextRandom(randomState, innerSize.w) + 1u, nextRandom(randomState, innerSize.h) + 1u };
+    if (get(position) == CellType::BACKGROUND) return position;
+  }
+  const auto innerCellCount{ static_cast<unsigned long long>(innerSize.w) * innerSize.h };
+  const auto begin{ nextRandom(randomState) % innerCellCount };
+  for (auto i{ 0ull }; i != innerCellCount; ++i) {
+    const auto index{ (begin + i) % innerCellCount };
+    const Point position{ static_cast<unsigned int>(index % innerSize.w) + 1u, static_cast<unsigned int>(index / innerSize.w) + 1u };
+    if (get(position) == CellType::BACKGROUND) return position;
+  }
+  return Point{ 0u, 0u };
+}
+
+unsigned long long CellGrid::getMemoryUsage() const {
+  return static_cast<unsigned long long>(chunkCount) * sizeof(Chunk) + chunks.capacity() * sizeof(Chunk*);
+}
+
+void CellGrid::clear() {
+  for (auto& chunk : chunks) {
+    if (chunk) trackFree(MemoryCategory::BOARD_MAP, MemoryUsage{ sizeof(Chunk), 1ll });
+    delete chunk;
+    chunk = nullptr;
+  }
+  chunkCount = 0u;
+}
+
+CellGrid::~CellGrid() {
+  clear();
+}
+
+}  // namespace ii887522::snake
@@ -0,0 +1,96 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_CELLGRID_H_
+#define SNAKE_SRC_MAIN_ANY_CELLGRID_H_
+
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <vector>
+#include "Enums.h"
+#include "TrackingAllocator.h"
+#include "Level.h"
+
+using std::vector;
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+// It stores the type of every cell of a board. The cells on the border and the walls of the level if any are always walls and are
+// not stored at all, the level is read in place instead. The rest are split into square chunks which are only allocated while
+// they hold something other than background, so the memory used grows with the cells occupied rather than with the board size.
+// Not Thread Safe
+class CellGrid final {
+  // remove copy semantics
+  CellGrid(const CellGrid&) = delete;
+  CellGrid& operator=(const CellGrid&) = delete;
+
+  // remove move semantics
+  CellGrid(CellGrid&&) = delete;
+  CellGrid& operator=(CellGrid&&) = delete;
+
+  static constexpr auto CHUNK_SIDE{ 64u };
+
+  struct Chunk final {
+    unsigned char cells[CHUNK_SIDE * CHUNK_SIDE];
+    unsigned int usedCount;  // the number of cells which are not background
+  };
+
+  const Size<unsigned int> size;
+  const Level*const level;  // it is nullptr if the board only has the border as walls
+  const unsigned int chunkColumnCount;
+  vector<Chunk*, TrackingAllocator<Chunk*, MemoryCategory::BOARD_MAP>> chunks;
+  unsigned int chunkCount;  // the number of chunks allocated
+
+  constexpr bool isBorder(const Point<unsigned int>& position) const {
+    return position.x == 0u || position.y == 0u || position.x == size.w - 1u || position.y == size.h - 1u;
+  }
+
+  constexpr bool isWall(const Point<unsigned int>& position) const {
+    return isBorder(position) || (level && level->isWall(position));
+  }
+
+  constexpr unsigned int getChunkIndex(const Point<unsigned int>& position) const {
+    return position.y / CHUNK_SIDE * chunkColumnCount + position.x / CHUNK_SIDE;
+  }
+
+  static constexpr unsigned int getCellIndex(const Point<unsigned int>& position) {
+    return position.y % CHUNK_SIDE * CHUNK_SIDE + position.x % CHUNK_SIDE;
+  }
+
+ public:
+  // Param size: each side must be at least 3 cells
+  // Param level: if it is not nullptr, its walls are walls of the board as well. It must have the size given.
+  explicit CellGrid(const Size<unsigned int>& size, const Level*const level = nullptr);
+
+  constexpr const Size<unsigned int>& getSize() const {
+    return size;
+  }
+
+  // Return: the level the board is laid out by, or nullptr if the board only has the border as walls
+  constexpr const Level* getLevel() const {
+    return level;
+  }
+
+  // Param position: it must be inside the board
+  CellType get(const Point<unsigned int>& position) const;
+
+  // Param position: it must be inside the board, nothing happens if it is a wall
+  void set(const Point<unsigned int>& position, const CellType);
+
+  // Param randomState: it is advanced, see also ../Functions/random_ext.h for more details
+  // Return: a random background cell, or a wall if there is none
+  Point<unsigned int> getRandomBackgroundCell(unsigned long long*const randomState) const;
+
+  // Return: the number of bytes allocated for the cells
+  unsigned long long getMemoryUsage() const;
+
+  // Sets every cell inside the border to background.
+  void clear();
+
+  ~CellGrid();
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_CELLGRID_H_
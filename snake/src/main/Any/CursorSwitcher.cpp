@@ -0,0 +1,36 @@
+// Copyright ii887522
+
+#include "CursorSwitcher.h"
+#include <SDL.h>
+#include <vector>
+#include <string_view>
+#include <algorithm>
+
+using std::vector;
+using std::string_view;
+using std::find;
+
+namespace ii887522::snake {
+
+CursorSwitcher::CursorSwitcher(SDL_Cursor*const pointer) : pointer{ pointer } { }
+
+void CursorSwitcher::enter(const char*const buttonName) {
+  if (find(hoveredButtonNames.begin(), hoveredButtonNames.end(), buttonName) != hoveredButtonNames.end()) return;
+  hoveredButtonNames.push_back(buttonName);
+  if (hoveredButtonNames.size() == 1u) SDL_SetCursor(pointer);
+}
+
+void CursorSwitcher::leave(const char*const buttonName) {
+  const auto hoveredButtonName{ find(hoveredButtonNames.begin(), hoveredButtonNames.end(), buttonName) };
+  if (hoveredButtonName == hoveredButtonNames.end()) return;
+  hoveredButtonNames.erase(hoveredButtonName);
+  if (hoveredButtonNames.empty()) SDL_SetCursor(SDL_GetDefaultCursor());
+}
+
+void CursorSwitcher::reset() {
+  if (hoveredButtonNames.empty()) return;
+  hoveredButtonNames.clear();
+  SDL_SetCursor(SDL_GetDefaultCursor());
+}
+
+}  // namespace ii887522::snake
@@ -0,0 +1,48 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_CURSORSWITCHER_H_
+#define SNAKE_SRC_MAIN_ANY_CURSORSWITCHER_H_
+
+#include <SDL.h>
+#include <vector>
+#include <string_view>
+
+using std::vector;
+using std::string_view;
+
+namespace ii887522::snake {
+
+// It shows the pointer cursor while the mouse is over any button and the default cursor otherwise. The cursor is only set when
+// that changes, rather than on every mouse event, since setting it redraws it even when it is the same. Each button is named so
+// that the mouse moving straight from one button to another keeps the pointer no matter which of them is told first.
+// Not Thread Safe: it must only be used in main thread
+class CursorSwitcher final {
+  // remove copy semantics
+  CursorSwitcher(const CursorSwitcher&) = delete;
+  CursorSwitcher& operator=(const CursorSwitcher&) = delete;
+
+  // remove move semantics
+  CursorSwitcher(CursorSwitcher&&) = delete;
+  CursorSwitcher& operator=(CursorSwitcher&&) = delete;
+
+  SDL_Cursor*const pointer;
+  vector<string_view> hoveredButtonNames;
+
+ public:
+  // Param pointer: it must not be assigned to integer
+  explicit CursorSwitcher(SDL_Cursor*const pointer);
+
+  // Param buttonName: it must point to a string literal
+  void enter(const char*const buttonName);
+
+  // Param buttonName: it must point to a string literal
+  void leave(const char*const buttonName);
+
+  // Shows the default cursor and forgets every button hovered. It must be called when the page showing changes, since buttons
+  // which are no longer shown never tell the mouse has left them.
+  void reset();
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_CURSORSWITCHER_H_
@@ -0,0 +1,45 @@
+// Copyright ii887522
+
+#include "DamageTracker.h"
+#include <SDL.h>
+#include <vector>
+
+using std::vector;
+
+namespace ii887522::snake {
+
+// Return: whether the rects given overlap or share an edge
+static constexpr bool isTouching(const SDL_Rect& left, const SDL_Rect& right) {
+  return left.x <= right.x + right.w && right.x <= left.x + left.w && left.y <= right.y + right.h && right.y <= left.y + left.h;
+}
+
+DamageTracker::DamageTracker(const unsigned int maxRectCount) : maxRectCount{ maxRectCount }, hasDamagedAll{ true } { }
+
+void DamageTracker::damage(const SDL_Rect& rect) {
+  if (hasDamagedAll || rect.w <= 0 || rect.h <= 0) return;
+  auto merged{ rect };
+  for (auto i{ 0u }; i != rects.size(); ) {
+    if (isTouching(rects[i], merged)) {
+      SDL_UnionRect(&rects[i], &merged, &merged);
+      rects[i] = rects.back();
+      rects.pop_back();
+      i = 0u;  // the merged rect may now touch a rect checked before
+    } else {
+      ++i;
+    }
+  }
+  rects.push_back(merged);
+  if (rects.size() > maxRectCount) damageAll();
+}
+
+void DamageTracker::damageAll() {
+  hasDamagedAll = true;
+  rects.clear();
+}
+
+void DamageTracker::clear() {
+  hasDamagedAll = false;
+  rects.clear();
+}
+
+}  // namespace ii887522::snake
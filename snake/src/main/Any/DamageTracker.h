@@ -0,0 +1,55 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_DAMAGETRACKER_H_
+#define SNAKE_SRC_MAIN_ANY_DAMAGETRACKER_H_
+
+#include <SDL.h>
+#include <vector>
+
+using std::vector;
+
+namespace ii887522::snake {
+
+// It collects the regions which have changed since the last redraw. Overlapping or touching regions are merged, and when there
+// are too many regions the whole area is considered damaged since redrawing everything becomes cheaper.
+// Not Thread Safe
+class DamageTracker final {
+  // remove copy semantics
+  DamageTracker(const DamageTracker&) = delete;
+  DamageTracker& operator=(const DamageTracker&) = delete;
+
+  // remove move semantics
+  DamageTracker(DamageTracker&&) = delete;
+  DamageTracker& operator=(DamageTracker&&) = delete;
+
+  const unsigned int maxRectCount;
+  vector<SDL_Rect> rects;
+  bool hasDamagedAll;
+
+ public:
+  // Param maxRectCount: the number of regions beyond which the whole area is considered damaged
+  explicit DamageTracker(const unsigned int maxRectCount = 32u);
+
+  constexpr bool isAllDamaged() const {
+    return hasDamagedAll;
+  }
+
+  bool isDamaged() const {
+    return hasDamagedAll || !rects.empty();
+  }
+
+  // Return: the regions damaged, it is meaningless if isAllDamaged()
+  const vector<SDL_Rect>& getRects() const {
+    return rects;
+  }
+
+  void damage(const SDL_Rect&);
+  void damageAll();
+
+  // It must be called after the regions damaged have been redrawn.
+  void clear();
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_DAMAGETRACKER_H_
@@ -6,13 +6,50 @@
 namespace ii887522::snake {
 
 enum class Path : unsigned int {
-  MAIN, GAME
+  MAIN, GAME, REPLAY, ARENA
 };
 
 enum class CellType : unsigned int {
   BACKGROUND, WALL, SNAKE_HEAD, SNAKE_BODY, FOOD
 };
 
+enum class Direction : unsigned int {
+  UP, RIGHT, DOWN, LEFT, COUNT
+};
+
+enum class Phase : unsigned int {
+  INPUT, STEP, CHECK_HITS, RENDER, COUNT
+};
+
+enum class ReplayEventType : unsigned int {
+  DIRECTION, FOOD
+};
+
+// The first 4 commands are the same as Direction
+enum class ClientCommand : unsigned char {
+  UP, RIGHT, DOWN, LEFT, RESTART, COUNT
+};
+
+enum class ServerMessageType : unsigned char {
+  STATE, DELTA
+};
+
+enum class VideoFormat : unsigned int {
+  Y4M, PPM
+};
+
+enum class RenderBackend : unsigned int {
+  RENDERER, SOFTWARE
+};
+
+enum class MemoryCategory : unsigned int {
+  BOARD_MAP, BOARD_TEXTURES, SNAKE_SEGMENTS, REACTIVE_WATCHERS, TEXT_TEXTURES, FONTS, MODAL_TREES, COUNT
+};
+
+enum class SoakInput : unsigned int {
+  RANDOM, AUTOPILOT
+};
+
 }  // namespace ii887522::snake
 
 #endif  // SNAKE_SRC_MAIN_ANY_ENUMS_H_
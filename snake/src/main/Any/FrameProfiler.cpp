@@ -0,0 +1,104 @@
+// Copyright ii887522
+
+#include "FrameProfiler.h"
+#include <string>
+#include <vector>
+#include <ostream>
+#include <fstream>
+#include <filesystem>
+#include <chrono>  // NOLINT(build/c++11)
+#include "Enums.h"
+#include "Histogram.h"
+#include "../Functions/time_ext.h"
+#include "../Functions/trace.h"
+#include "../Functions/accounting.h"
+
+using std::string;
+using std::vector;
+using std::ostream;
+using std::ofstream;
+using std::filesystem::create_directories;
+using std::chrono::high_resolution_clock;
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+
+namespace ii887522::snake {
+
+static constexpr const char* phaseNames[]{ "input", "step", "checkAndReactHits", "render" };
+
+FrameProfiler::FrameProfiler(const string& dirPath, const vector<string>& sectionNames) : dirPath{ dirPath },
+  sectionNames{ sectionNames }, histograms(sectionNames.size()), frameCount{ 0ull }, tickCount{ 0ull }, drawCallCount{ 0ull },
+  prevAllocationCount{ getAllocationCount() }, lastPhase{ Phase::INPUT }, lastProbeIndex{ 0u }, hasMarked{ false },
+  hasFramed{ false } { }
+
+void FrameProfiler::mark(const Phase phase, const unsigned int probeIndex) {
+  const auto now{ high_resolution_clock::now() };
+  if (hasMarked && phase == lastPhase && (probeIndex == lastProbeIndex + 1u || probeIndex + 1u == lastProbeIndex)) {
+    const auto sectionIndex{ probeIndex < lastProbeIndex ? probeIndex : lastProbeIndex };
+    histograms[sectionIndex][static_cast<unsigned int>(phase)].add(duration_cast<microseconds>(now - lastTime).count());
+    traceComplete(sectionNames[sectionIndex].c_str(), phaseNames[static_cast<unsigned int>(phase)], lastTime, now);
+  }
+  if (phase == Phase::RENDER && probeIndex == 0u) {
+    if (hasFramed) {
+      frameHistogram.add(duration_cast<microseconds>(now - lastFrameTime).count());
+      traceComplete("frame", "frame", lastFrameTime, now);
+    }
+    lastFrameTime = now;
+    hasFramed = true;
+    ++frameCount;
+  }
+  lastPhase = phase;
+  lastProbeIndex = probeIndex;
+  hasMarked = true;
+  // Read the clock again so that the bookkeeping above is not charged to the next view
+  lastTime = high_resolution_clock::now();
+}
+
+void FrameProfiler::writeJson(ostream& stream) const {
+  stream << "{\n  \"frames\": " << frameCount << ",\n  \"ticks\": " << tickCount << ",\n  \"drawCalls\": " << drawCallCount <<
+    ",\n  \"allocations\": " << getAllocationCount() - prevAllocationCount << ",\n  \"memory\": ";
+  writeMemoryJson(stream);
+  stream << ",\n  \"frame\": ";
+  frameHistogram.writeJson(stream);
+  stream << ",\n  \"views\": {";
+  for (auto i{ 0u }; i != sectionNames.size(); ++i) {
+    stream << (i == 0u ? "\n" : ",\n") << "    \"" << sectionNames[i] << "\": {";
+    for (auto j{ 0u }; j != static_cast<unsigned int>(Phase::COUNT); ++j) {
+      stream << (j == 0u ? "\n" : ",\n") << "      \"" << phaseNames[j] << "\": ";
+      histograms[i][j].writeJson(stream);
+    }
+    stream << "\n    }";
+  }
+  stream << "\n  }\n}\n";
+}
+
+void FrameProfiler::dump() const {
+  if (dirPath.empty()) return;
+  create_directories(dirPath);
+  ofstream file{ dirPath + getTimestamp() + ".json" };
+  writeJson(file);
+}
+
+void FrameProfiler::toggleTracing() const {
+  if (isTracing()) stopTracing();
+  else if (!dirPath.empty()) startTracing(dirPath + getTimestamp() + ".trace.json");
+}
+
+void FrameProfiler::reset() {
+  for (auto& phaseHistograms : histograms) {
+    for (auto& histogram : phaseHistograms) histogram.reset();
+  }
+  frameHistogram.reset();
+  frameCount = 0ull;
+  tickCount = 0ull;
+  drawCallCount = 0ull;
+  prevAllocationCount = getAllocationCount();
+  hasMarked = false;
+  hasFramed = false;
+}
+
+FrameProfiler::~FrameProfiler() {
+  if (frameCount != 0ull) dump();
+}
+
+}  // namespace ii887522::snake
@@ -0,0 +1,94 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_FRAMEPROFILER_H_
+#define SNAKE_SRC_MAIN_ANY_FRAMEPROFILER_H_
+
+#include <string>
+#include <vector>
+#include <array>
+#include <ostream>
+#include <chrono>  // NOLINT(build/c++11)
+#include "Enums.h"
+#include "Histogram.h"
+
+using std::string;
+using std::vector;
+using std::array;
+using std::ostream;
+using std::chrono::high_resolution_clock;
+
+namespace ii887522::snake {
+
+// It measures how long each view of a page spends in every phase of a frame. The page is instrumented by putting a ProbeView
+// before the first view, between every 2 views and after the last view. Whenever 2 adjacent probes are reached one after another
+// in the same phase, the time between them is charged to the view in between, so it works no matter in which order the page
+// visits its views and it does not need to know anything about the views being measured.
+// See also ../View/ProbeView.h for more details
+// Not Thread Safe: it must only be used in main thread
+class FrameProfiler final {
+  // remove copy semantics
+  FrameProfiler(const FrameProfiler&) = delete;
+  FrameProfiler& operator=(const FrameProfiler&) = delete;
+
+  // remove move semantics
+  FrameProfiler(FrameProfiler&&) = delete;
+  FrameProfiler& operator=(FrameProfiler&&) = delete;
+
+  const string dirPath;
+  const vector<string> sectionNames;
+  vector<array<Histogram, static_cast<unsigned int>(Phase::COUNT)>> histograms;
+  Histogram frameHistogram;
+  unsigned long long frameCount;
+  unsigned long long tickCount;
+  unsigned long long drawCallCount;
+  unsigned long long prevAllocationCount;  // the allocation count when the profiler was created or reset
+  Phase lastPhase;
+  unsigned int lastProbeIndex;
+  high_resolution_clock::time_point lastTime;
+  high_resolution_clock::time_point lastFrameTime;
+  bool hasMarked;
+  bool hasFramed;
+
+ public:
+  // Param dirPath: it must end with a slash, or be empty to write nothing
+  // Param sectionNames: the names of the views being measured in the order they are put in the page
+  explicit FrameProfiler(const string& dirPath, const vector<string>& sectionNames);
+
+  // Return: the number of probes needed to instrument the page
+  unsigned int getProbeCount() const {
+    return static_cast<unsigned int>(sectionNames.size()) + 1u;
+  }
+
+  // Param probeIndex: it must be less than getProbeCount()
+  void mark(const Phase, const unsigned int probeIndex);
+
+  constexpr void countTick() {
+    ++tickCount;
+  }
+
+  constexpr void countDrawCalls(const unsigned int value) {
+    drawCallCount += value;
+  }
+
+  constexpr unsigned long long getDrawCallCount() const {
+    return drawCallCount;
+  }
+
+  void writeJson(ostream&) const;
+
+  // Writes the stats collected into a new JSON file in dirPath.
+  void dump() const;
+
+  // Starts recording a timeline trace into a new file in dirPath, or stops it if it is being recorded.
+  // See also ../Functions/trace.h for more details
+  void toggleTracing() const;
+
+  void reset();
+
+  // It dumps the stats collected one last time before the app exits.
+  ~FrameProfiler();
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_FRAMEPROFILER_H_
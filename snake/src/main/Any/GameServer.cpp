@@ -0,0 +1,233 @@
+// Copyright ii887522
+
+#include "GameServer.h"
+#include <winsock2.h>
+#include <Struct/Size.h>
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <stdexcept>
+#include <chrono>  // NOLINT(build/c++11)
+#include "Enums.h"
+#include "ThreadPool.h"
+#include "../Struct/Session.h"
+#include "../Model/Simulation.h"
+#include "../Functions/buffer_ext.h"
+#include "../Functions/random_ext.h"
+
+using std::vector;
+using std::max;
+using std::runtime_error;
+using std::chrono::steady_clock;
+using std::chrono::milliseconds;
+using std::chrono::duration_cast;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+GameServer::GameServer(const unsigned short port, const Size<unsigned int>& boardSize, ThreadPool& threadPool,
+  const unsigned long long seed) : boardSize{ boardSize }, threadPool{ threadPool }, listener{ socket(AF_INET, SOCK_STREAM, IPPROTO_TCP) },
+  isStopping{ false }, randomState{ seed } {
+  if (listener == INVALID_SOCKET) throw runtime_error{ "Failed to create the server socket!" };
+  const char isReuseAddress{ 1 };
+  setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &isReuseAddress, sizeof isReuseAddress);
+  sockaddr_in address{ };
+  address.sin_family = AF_INET;
+  address.sin_port = htons(port);
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  u_long isNonBlocking{ 1u };
+  if (bind(listener, reinterpret_cast<const sockaddr*>(&address), sizeof address) == SOCKET_ERROR || listen(listener, SOMAXCONN) == SOCKET_ERROR ||
+    ioctlsocket(listener, FIONBIO, &isNonBlocking) == SOCKET_ERROR) {
+    closesocket(listener);
+    throw runtime_error{ "Failed to listen on the server port!" };
+  }
+  pollFds.push_back(WSAPOLLFD{ listener, POLLRDNORM, 0 });
+}
+
+void GameServer::accept() {
+  while (true) {
+    const auto l_socket{ ::accept(listener, nullptr, nullptr) };
+    if (l_socket == INVALID_SOCKET) return;
+    u_long isNonBlocking{ 1u };
+    const char isNoDelay{ 1 };
+    ioctlsocket(l_socket, FIONBIO, &isNonBlocking);
+    setsockopt(l_socket, IPPROTO_TCP, TCP_NODELAY, &isNoDelay, sizeof isNoDelay);
+    Session* session;
+    if (freeSessions.empty()) {
+      session = new Session{ l_socket, new Simulation{ boardSize }, 0ull, Direction::UP, false, false, vector<char>{ }, 0u };
+    } else {
+      session = freeSessions.back();
+      freeSessions.pop_back();
+      session->socket = l_socket;
+    }
+    session->randomState = nextRandom(&randomState);
+    sessions.push_back(session);
+    pollFds.push_back(WSAPOLLFD{ l_socket, POLLRDNORM, 0 });
+    restart(*session);
+  }
+}
+
+void GameServer::restart(Session& session) {
+  session.simulation->reborn(Direction::UP);
+  session.direction = Direction::UP;
+  session.simulation->setFood(session.simulation->getRandomBackgroundCell(&session.randomState));
+  session.isPlaying = true;
+  writeState(session);
+}
+
+void GameServer::receive(Session& session) {
+  char buffer[RECEIVE_BUFFER_SIZE];
+  while (true) {
+    const auto size{ recv(session.socket, buffer, sizeof buffer, 0) };
+    if (size == SOCKET_ERROR) {
+      if (WSAGetLastError() != WSAEWOULDBLOCK) session.isClosing = true;
+      return;
+    }
+    if (size == 0) {
+      session.isClosing = true;
+      return;
+    }
+    for (auto i{ 0 }; i != size; ++i) {
+      const auto command{ static_cast<ClientCommand>(buffer[i]) };
+      if (command == ClientCommand::RESTART) {
+        if (!session.isPlaying) restart(session);
+      } else if (command < ClientCommand::RESTART) {
+        // The snake can not turn back into itself, the same as in the game page
+        const auto direction{ static_cast<Direction>(command) };
+        if ((static_cast<unsigned int>(direction) + 2u) % static_cast<unsigned int>(Direction::COUNT) !=
+          static_cast<unsigned int>(session.simulation->getDirection())) session.direction = direction;
+      } else {
+        session.isClosing = true;
+        return;
+      }
+    }
+  }
+}
+
+void GameServer::flush(Session& session) {
+  while (session.outboxOffset != session.outbox.size()) {
+    const auto size{
+      send(session.socket, session.outbox.data() + session.outboxOffset, static_cast<int>(session.outbox.size() - session.outboxOffset), 0)
+    };
+    if (size == SOCKET_ERROR) {
+      if (WSAGetLastError() != WSAEWOULDBLOCK) session.isClosing = true;
+      break;
+    }
+    session.outboxOffset += size;
+  }
+  if (session.outboxOffset == session.outbox.size()) {
+    // The capacity is kept so that steady play stops allocating
+    session.outbox.clear();
+    session.outboxOffset = 0u;
+  } else if (session.outbox.size() - session.outboxOffset > MAX_OUTBOX_SIZE) {
+    session.isClosing = true;
+  }
+}
+
+void GameServer::step(Session& session) {
+  if (!session.isPlaying) return;
+  auto& simulation{ *session.simulation };
+  unsigned char flags{ 0u };
+  if (simulation.step(session.direction)) {
+    flags |= DELTA_GROWN;
+    const auto food{ simulation.getRandomBackgroundCell(&session.randomState) };
+    if (simulation.get(food) == CellType::BACKGROUND) {
+      simulation.setFood(food);
+      flags |= DELTA_FOOD;
+    }
+  }
+  if (simulation.isOver()) {
+    flags |= DELTA_DEAD;
+    session.isPlaying = false;
+  }
+  writeLittleEndian(&session.outbox, static_cast<unsigned char>(ServerMessageType::DELTA));
+  writeLittleEndian(&session.outbox, simulation.getTick());
+  writeLittleEndian(&session.outbox, static_cast<unsigned short>(simulation.getBody().front().x));
+  writeLittleEndian(&session.outbox, static_cast<unsigned short>(simulation.getBody().front().y));
+  writeLittleEndian(&session.outbox, flags);
+  if (flags & DELTA_FOOD) {
+    writeLittleEndian(&session.outbox, static_cast<unsigned short>(simulation.getFood().x));
+    writeLittleEndian(&session.outbox, static_cast<unsigned short>(simulation.getFood().y));
+  }
+}
+
+void GameServer::close(const unsigned int index) {
+  const auto session{ sessions[index] };
+  closesocket(session->socket);
+  session->isClosing = false;
+  session->isPlaying = false;
+  session->outbox.clear();
+  session->outboxOffset = 0u;
+  freeSessions.push_back(session);
+  sessions[index] = sessions.back();
+  sessions.pop_back();
+  pollFds[index + 1u] = pollFds.back();
+  pollFds.pop_back();
+}
+
+void GameServer::writeState(Session& session) {
+  const auto& simulation{ *session.simulation };
+  writeLittleEndian(&session.outbox, static_cast<unsigned char>(ServerMessageType::STATE));
+  writeLittleEndian(&session.outbox, static_cast<unsigned short>(simulation.getSize().w));
+  writeLittleEndian(&session.outbox, static_cast<unsigned short>(simulation.getSize().h));
+  writeLittleEndian(&session.outbox, simulation.getTick());
+  writeLittleEndian(&session.outbox, static_cast<unsigned int>(simulation.getBody().size()));
+  for (const auto& position : simulation.getBody()) {
+    writeLittleEndian(&session.outbox, static_cast<unsigned short>(position.x));
+    writeLittleEndian(&session.outbox, static_cast<unsigned short>(position.y));
+  }
+  writeLittleEndian(&session.outbox, static_cast<unsigned char>(simulation.isFoodSpawned()));
+  writeLittleEndian(&session.outbox, static_cast<unsigned short>(simulation.getFood().x));
+  writeLittleEndian(&session.outbox, static_cast<unsigned short>(simulation.getFood().y));
+}
+
+void GameServer::run() {
+  auto nextTickTime{ steady_clock::now() + milliseconds{ TICK_DURATION } };
+  while (!isStopping) {
+    for (auto i{ 0u }; i != sessions.size(); ++i)
+      pollFds[i + 1u].events = sessions[i]->outbox.empty() ? POLLRDNORM : POLLRDNORM | POLLWRNORM;
+    const auto timeout{ max(duration_cast<milliseconds>(nextTickTime - steady_clock::now()), milliseconds{ 0 }).count() };
+    WSAPoll(pollFds.data(), static_cast<unsigned long>(pollFds.size()), static_cast<int>(timeout));
+    // Iterates backward so that closing a session only moves a session which has been visited
+    for (auto i{ static_cast<unsigned int>(sessions.size()) }; i-- != 0u; ) {
+      const auto events{ pollFds[i + 1u].revents };
+      pollFds[i + 1u].revents = 0;
+      if (events & (POLLERR | POLLHUP | POLLNVAL)) sessions[i]->isClosing = true;
+      if (!sessions[i]->isClosing && (events & POLLRDNORM)) receive(*sessions[i]);
+      if (!sessions[i]->isClosing && (events & POLLWRNORM)) flush(*sessions[i]);
+      if (sessions[i]->isClosing) close(i);
+    }
+    if (pollFds.front().revents & POLLRDNORM) accept();
+    pollFds.front().revents = 0;
+    if (steady_clock::now() < nextTickTime) continue;
+    threadPool.parallelFor(static_cast<unsigned int>(sessions.size()), [this](const unsigned int begin, const unsigned int end) {
+      for (auto i{ begin }; i != end; ++i) step(*sessions[i]);
+    });
+    for (auto i{ static_cast<unsigned int>(sessions.size()) }; i-- != 0u; ) {
+      flush(*sessions[i]);
+      if (sessions[i]->isClosing) close(i);
+    }
+    // A server which has fallen behind skips the ticks missed rather than running them in a burst
+    nextTickTime += milliseconds{ TICK_DURATION };
+    if (nextTickTime <= steady_clock::now()) nextTickTime = steady_clock::now() + milliseconds{ TICK_DURATION };
+  }
+}
+
+void GameServer::stop() {
+  isStopping = true;
+}
+
+GameServer::~GameServer() {
+  for (const auto session : sessions) {
+    closesocket(session->socket);
+    delete session->simulation;
+    delete session;
+  }
+  for (const auto session : freeSessions) {
+    delete session->simulation;
+    delete session;
+  }
+  closesocket(listener);
+}
+
+}  // namespace ii887522::snake
@@ -0,0 +1,93 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_GAMESERVER_H_
+#define SNAKE_SRC_MAIN_ANY_GAMESERVER_H_
+
+#include <winsock2.h>
+#include <Struct/Size.h>
+#include <vector>
+#include <atomic>
+#include "../Struct/Session.h"
+#include "ThreadPool.h"
+
+using std::vector;
+using std::atomic;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+// It hosts a game for every client connected over TCP without any window. A client sends 1 byte ClientCommand at any time and
+// receives the game state once it joins or restarts, then a delta of it on every tick.
+//
+// Every message begins with a ServerMessageType byte and all integers are in little endian byte order:
+//   STATE: width u16, height u16, tick u32, body length u32, body cells as x u16 y u16 from the head, has food u8, food x u16
+//     food y u16
+//   DELTA: tick u32, head x u16, head y u16, flags u8 which are a combination of DELTA_GROWN, DELTA_DEAD and DELTA_FOOD, food x u16
+//     food y u16 if DELTA_FOOD is set
+//
+// 1 thread waits for every socket at once and does all the I/O, while the games are stepped in batches by the thread pool.
+// Not Thread Safe: only stop() may be called from another thread
+class GameServer final {
+  // remove copy semantics
+  GameServer(const GameServer&) = delete;
+  GameServer& operator=(const GameServer&) = delete;
+
+  // remove move semantics
+  GameServer(GameServer&&) = delete;
+  GameServer& operator=(GameServer&&) = delete;
+
+  static constexpr auto TICK_DURATION{ 62u };  // in milliseconds, the same as the snake speed in the game page
+  static constexpr auto MAX_OUTBOX_SIZE{ 65536u };  // a client which falls this many bytes behind is dropped
+  static constexpr auto RECEIVE_BUFFER_SIZE{ 256u };
+
+  const Size<unsigned int> boardSize;
+  ThreadPool& threadPool;
+  SOCKET listener;
+  atomic<bool> isStopping;
+  unsigned long long randomState;  // it seeds the random states of the sessions
+  vector<Session*> sessions;
+  vector<Session*> freeSessions;  // the sessions which have been closed and can be reused
+  vector<WSAPOLLFD> pollFds;  // the first one is the listener, the others are the sessions in the same order
+
+  void accept();
+  void restart(Session&);
+
+  // Reads every command which has arrived.
+  void receive(Session&);
+
+  // Sends as many bytes in the outbox as the socket accepts without blocking.
+  void flush(Session&);
+
+  // It is called by many threads at once, but for different sessions.
+  void step(Session&);
+
+  // Param index: the index of the session in sessions, the last session takes its place
+  void close(const unsigned int index);
+
+  void writeState(Session&);
+
+ public:
+  static constexpr unsigned char DELTA_GROWN{ 1u };
+  static constexpr unsigned char DELTA_DEAD{ 2u };
+  static constexpr unsigned char DELTA_FOOD{ 4u };
+
+  // Param port: it listens on every address at this port
+  // Param boardSize: the number of cells on each side of each board including the walls
+  // Param threadPool: it steps the games
+  // Param seed: it decides where the foods spawn
+  explicit GameServer(const unsigned short port, const Size<unsigned int>& boardSize, ThreadPool& threadPool,
+    const unsigned long long seed);
+
+  // Serves the clients until stop() is called.
+  void run();
+
+  // It makes run() return within 1 tick.
+  // Thread Safe
+  void stop();
+
+  ~GameServer();
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_GAMESERVER_H_
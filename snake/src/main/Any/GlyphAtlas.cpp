@@ -0,0 +1,137 @@
+// Copyright ii887522
+
+#include "GlyphAtlas.h"
+#include <Struct/Point.h>
+#include <Struct/Color.h>
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <array>
+#include "Enums.h"
+#include "../Functions/accounting.h"
+
+using std::array;
+using ii887522::viewify::Point;
+using ii887522::viewify::Color;
+
+namespace ii887522::snake {
+
+GlyphAtlas::GlyphAtlas(SDL_Renderer*const renderer, const int ptSize) : renderer{ renderer },
+  placeholderLineHeight{ ptSize * 23 / 20 }, surface{ nullptr }, glyphRects{ }, lineHeight{ 0 }, width{ 0 }, height{ 0 },
+  texture{ nullptr } { }
+
+void GlyphAtlas::bake(TTF_Font*const font) {
+  lineHeight = TTF_FontHeight(font);
+  height = lineHeight;
+  array<SDL_Surface*, LAST_GLYPH - FIRST_GLYPH + 1> glyphSurfaces;
+  Point position{ 0, 0 };
+  for (auto glyph{ FIRST_GLYPH }; glyph <= LAST_GLYPH; ++glyph) {
+    // Glyphs are baked in white so that they can be tinted into any color when rendered
+    const auto glyphSurface{ TTF_RenderGlyph_Blended(font, static_cast<Uint16>(glyph), SDL_Color{ 255u, 255u, 255u, 255u }) };
+    glyphSurfaces[glyph - FIRST_GLYPH] = glyphSurface;
+    auto advance{ 0 };
+    TTF_GlyphMetrics(font, static_cast<Uint16>(glyph), nullptr, nullptr, nullptr, nullptr, &advance);
+    const auto glyphWidth{ glyphSurface ? glyphSurface->w : advance };
+    if (position.x + glyphWidth > MAX_WIDTH) {
+      position = Point{ 0, position.y + lineHeight };
+      height += lineHeight;
+    }
+    glyphRects[glyph - FIRST_GLYPH] = SDL_Rect{ position.x, position.y, glyphWidth, lineHeight };
+    position.x += glyphWidth;
+    if (position.x > width) width = position.x;
+  }
+  surface = SDL_CreateRGBSurfaceWithFormat(0u, width, height, 32, SDL_PIXELFORMAT_ARGB8888);
+  SDL_FillRect(surface, nullptr, SDL_MapRGBA(surface->format, 255u, 255u, 255u, 0u));
+  for (auto i{ 0u }; i != glyphSurfaces.size(); ++i) {
+    if (!glyphSurfaces[i]) continue;
+    // Copy the alpha of the glyph as it is instead of blending it onto the transparent atlas
+    SDL_SetSurfaceBlendMode(glyphSurfaces[i], SDL_BLENDMODE_NONE);
+    SDL_BlitSurface(glyphSurfaces[i], nullptr, surface, &glyphRects[i]);
+    SDL_FreeSurface(glyphSurfaces[i]);
+  }
+}
+
+void GlyphAtlas::upload() {
+  texture = SDL_CreateTextureFromSurface(renderer, surface);
+  if (texture) trackAllocation(MemoryCategory::TEXT_TEXTURES, getTextureUsage(texture));
+  SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+  SDL_FreeSurface(surface);
+  surface = nullptr;
+}
+
+int GlyphAtlas::getWidth(const char*const text) const {
+  auto l_width{ 0 };
+  for (auto i{ 0u }; text[i] != '\0'; ++i) {
+    if (isPrintable(text[i])) l_width += texture ? glyphRects[text[i] - FIRST_GLYPH].w : placeholderLineHeight >> 1u;
+  }
+  return l_width;
+}
+
+void GlyphAtlas::renderPlaceholder(const Point<int>& position, const char*const text, const Color<unsigned int>& color) const {
+  SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+  SDL_SetRenderDrawColor(renderer, static_cast<Uint8>(color.r), static_cast<Uint8>(color.g), static_cast<Uint8>(color.b),
+    static_cast<Uint8>(color.a >> 2u));
+  const SDL_Rect rect{ position.x, position.y + (placeholderLineHeight >> 2u), getWidth(text), placeholderLineHeight >> 1u };
+  SDL_RenderFillRect(renderer, &rect);
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+void GlyphAtlas::render(const Point<int>& position, const char*const text, const Color<unsigned int>& color) const {
+  if (!texture) {
+    renderPlaceholder(position, text, color);
+    return;
+  }
+  const SDL_Color vertexColor{
+    static_cast<Uint8>(color.r), static_cast<Uint8>(color.g), static_cast<Uint8>(color.b), static_cast<Uint8>(color.a)
+  };
+  vertices.clear();
+  indices.clear();
+  auto x{ static_cast<float>(position.x) };
+  const auto top{ static_cast<float>(position.y) };
+  for (auto i{ 0u }; text[i] != '\0'; ++i) {
+    if (!isPrintable(text[i])) continue;
+    const auto& glyphRect{ glyphRects[text[i] - FIRST_GLYPH] };
+    const auto right{ x + glyphRect.w };
+    const auto bottom{ top + glyphRect.h };
+    const auto u0{ static_cast<float>(glyphRect.x) / width };
+    const auto v0{ static_cast<float>(glyphRect.y) / height };
+    const auto u1{ static_cast<float>(glyphRect.x + glyphRect.w) / width };
+    const auto v1{ static_cast<float>(glyphRect.y + glyphRect.h) / height };
+    const auto firstIndex{ static_cast<int>(vertices.size()) };
+    vertices.push_back(SDL_Vertex{ SDL_FPoint{ x, top }, vertexColor, SDL_FPoint{ u0, v0 } });
+    vertices.push_back(SDL_Vertex{ SDL_FPoint{ right, top }, vertexColor, SDL_FPoint{ u1, v0 } });
+    vertices.push_back(SDL_Vertex{ SDL_FPoint{ right, bottom }, vertexColor, SDL_FPoint{ u1, v1 } });
+    vertices.push_back(SDL_Vertex{ SDL_FPoint{ x, bottom }, vertexColor, SDL_FPoint{ u0, v1 } });
+    for (const auto offset : { 0, 1, 2, 0, 2, 3 }) indices.push_back(firstIndex + offset);
+    x = right;
+  }
+  if (indices.empty()) return;
+  SDL_RenderGeometry(renderer, texture, vertices.data(), static_cast<int>(vertices.size()), indices.data(),
+    static_cast<int>(indices.size()));
+}
+#else
+void GlyphAtlas::render(const Point<int>& position, const char*const text, const Color<unsigned int>& color) const {
+  if (!texture) {
+    renderPlaceholder(position, text, color);
+    return;
+  }
+  SDL_SetTextureColorMod(texture, static_cast<Uint8>(color.r), static_cast<Uint8>(color.g), static_cast<Uint8>(color.b));
+  SDL_SetTextureAlphaMod(texture, static_cast<Uint8>(color.a));
+  auto x{ position.x };
+  for (auto i{ 0u }; text[i] != '\0'; ++i) {
+    if (!isPrintable(text[i])) continue;
+    const auto& glyphRect{ glyphRects[text[i] - FIRST_GLYPH] };
+    const SDL_Rect destinationRect{ x, position.y, glyphRect.w, glyphRect.h };
+    SDL_RenderCopy(renderer, texture, &glyphRect, &destinationRect);
+    x += glyphRect.w;
+  }
+}
+#endif
+
+GlyphAtlas::~GlyphAtlas() {
+  if (surface) SDL_FreeSurface(surface);
+  if (!texture) return;
+  trackFree(MemoryCategory::TEXT_TEXTURES, getTextureUsage(texture));
+  SDL_DestroyTexture(texture);
+}
+
+}  // namespace ii887522::snake
@@ -0,0 +1,101 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_GLYPHATLAS_H_
+#define SNAKE_SRC_MAIN_ANY_GLYPHATLAS_H_
+
+#include <Struct/Point.h>
+#include <Struct/Color.h>
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <array>
+#include <vector>
+
+using std::array;
+using std::vector;
+using ii887522::viewify::Point;
+using ii887522::viewify::Color;
+
+namespace ii887522::snake {
+
+// It pre-bakes every printable ASCII glyph of a font into 1 texture, so drawing text every frame only copies rectangles out of
+// that texture instead of rasterizing the text and creating a new texture each time it changes. When the SDL linked supports it,
+// all glyphs of a text are drawn as a batch of textured quads in 1 SDL_RenderGeometry() call. Before SDL 2.0.18, such as the
+// 2.0.12 the app is built with, each glyph is 1 SDL_RenderCopy() instead, which is only merged with the others if render
+// batching is on. Baking can run on a background
+// thread, and texts are drawn as placeholder bars until the atlas is uploaded.
+// Not Thread Safe: bake() can be called from a background thread, but everything else must only be used in main thread and
+// upload() must not be called before bake() has returned
+// See also AssetLoader.h for more details
+class GlyphAtlas final {
+  // remove copy semantics
+  GlyphAtlas(const GlyphAtlas&) = delete;
+  GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+  // remove move semantics
+  GlyphAtlas(GlyphAtlas&&) = delete;
+  GlyphAtlas& operator=(GlyphAtlas&&) = delete;
+
+  static constexpr auto FIRST_GLYPH{ ' ' };
+  static constexpr auto LAST_GLYPH{ '~' };
+  static constexpr auto MAX_WIDTH{ 1024 };  // glyphs wrap into the next row beyond this width to keep the texture small
+
+  SDL_Renderer*const renderer;
+  const int placeholderLineHeight;  // the line height assumed before the atlas is uploaded
+
+  // They are written by bake() and only read in main thread after upload()
+  SDL_Surface* surface;
+  array<SDL_Rect, LAST_GLYPH - FIRST_GLYPH + 1> glyphRects;  // where each glyph is in the texture
+  int lineHeight;
+  int width;  // texture width
+  int height;  // texture height
+
+  SDL_Texture* texture;
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+  // They are kept between calls so that rendering does not allocate once they have grown to the longest text drawn
+  mutable vector<SDL_Vertex> vertices;
+  mutable vector<int> indices;
+#endif
+
+  static constexpr bool isPrintable(const char glyph) {
+    return glyph >= FIRST_GLYPH && glyph <= LAST_GLYPH;
+  }
+
+  // Draws a translucent bar as wide as the text is estimated to be.
+  void renderPlaceholder(const Point<int>& position, const char*const text, const Color<unsigned int>& color) const;
+
+ public:
+  // Param renderer: it must not be assigned to integer
+  // Param ptSize: the point size of the font which will be baked
+  explicit GlyphAtlas(SDL_Renderer*const renderer, const int ptSize);
+
+  constexpr bool isUploaded() const {
+    return texture;
+  }
+
+  constexpr int getLineHeight() const {
+    return texture ? lineHeight : placeholderLineHeight;
+  }
+
+  // Rasterizes every glyph into a CPU-side surface without touching the renderer.
+  // Param font: it must not be assigned to integer. It is not owned and only used while baking the glyphs, so it can be closed
+  // right after this call.
+  void bake(TTF_Font*const font);
+
+  // Turns the surface baked into a texture.
+  void upload();
+
+  // Param text: glyphs which are not printable ASCII are skipped
+  // Return: the width of the text given in pixels. It is estimated before the atlas is uploaded.
+  int getWidth(const char*const text) const;
+
+  // Param position: the top left corner of the text
+  // Param text: glyphs which are not printable ASCII are skipped
+  void render(const Point<int>& position, const char*const text, const Color<unsigned int>& color) const;
+
+  ~GlyphAtlas();
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_GLYPHATLAS_H_
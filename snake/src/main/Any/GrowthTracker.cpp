@@ -0,0 +1,54 @@
+// Copyright ii887522
+
+#include "GrowthTracker.h"
+#include <string>
+#include <vector>
+#include <ostream>
+
+using std::string;
+using std::vector;
+using std::ostream;
+
+namespace ii887522::snake {
+
+GrowthTracker::GrowthTracker(const unsigned int warmUpSampleCount) : warmUpSampleCount{ warmUpSampleCount }, samples{ } { }
+
+double GrowthTracker::getTrend(const vector<double>& values) {
+  auto score{ 0ll };
+  for (auto i{ 0u }; i != values.size(); ++i) {
+    for (auto j{ i + 1u }; j != values.size(); ++j) {
+      if (values[j] > values[i]) ++score;
+      else if (values[j] < values[i]) --score;
+    }
+  }
+  return static_cast<double>(score) / (values.size() * (values.size() - 1u) >> 1u);
+}
+
+void GrowthTracker::add(const string& name, const double value) {
+  samples[name].push_back(value);
+}
+
+bool GrowthTracker::isGrowing(const string& name) const {
+  const auto& values{ samples.at(name) };
+  if (values.size() < warmUpSampleCount + MIN_SAMPLE_COUNT) return false;
+  const vector<double> warmValues(values.begin() + warmUpSampleCount, values.end());
+  return warmValues.back() > warmValues.front() && getTrend(warmValues) >= MIN_TREND;
+}
+
+unsigned int GrowthTracker::report(ostream& stream) const {
+  auto growingCount{ 0u };
+  for (const auto& [name, values] : samples) {
+    if (values.size() < warmUpSampleCount + MIN_SAMPLE_COUNT) {
+      stream << name << " (too few samples)\n";
+      continue;
+    }
+    const vector<double> warmValues(values.begin() + warmUpSampleCount, values.end());
+    const auto isMetricGrowing{ isGrowing(name) };
+    if (isMetricGrowing) ++growingCount;
+    stream << name << ' ' << warmValues.front() << " -> " << warmValues.back() << " (trend " << getTrend(warmValues) << ')' <<
+      (isMetricGrowing ? " GROWING" : "") << '\n';
+  }
+  return growingCount;
+}
+
+}  // namespace ii887522::snake
@@ -0,0 +1,61 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_GROWTHTRACKER_H_
+#define SNAKE_SRC_MAIN_ANY_GROWTHTRACKER_H_
+
+#include <string>
+#include <vector>
+#include <map>
+#include <ostream>
+
+using std::string;
+using std::vector;
+using std::map;
+using std::ostream;
+
+namespace ii887522::snake {
+
+// It samples measurements which must stay flat over a long run, such as memory usage, and tells which of them keep going up. The
+// samples taken while warming up are ignored since caches and pools fill up then. A metric is growing if its Kendall rank
+// correlation with time is at least MIN_TREND, which is about how often a later sample is higher than an earlier one rather than
+// by how much, so a slow leak is caught as well as a fast one while a noisy but flat metric is not.
+// Not Thread Safe
+class GrowthTracker final {
+  // remove copy semantics
+  GrowthTracker(const GrowthTracker&) = delete;
+  GrowthTracker& operator=(const GrowthTracker&) = delete;
+
+  // remove move semantics
+  GrowthTracker(GrowthTracker&&) = delete;
+  GrowthTracker& operator=(GrowthTracker&&) = delete;
+
+  static constexpr auto MIN_SAMPLE_COUNT{ 8u };  // after warming up, fewer samples tell nothing
+  static constexpr auto MIN_TREND{ .6 };
+
+  const unsigned int warmUpSampleCount;
+  map<string, vector<double>> samples;  // every sample of each metric in the order they are taken
+
+  // Param values: it must have at least 2 values
+  // Return: the Kendall rank correlation of the values with their indices, which is 1 if every value is higher than the ones
+  //   before it, -1 if it is lower and around 0 if they do not trend
+  static double getTrend(const vector<double>& values);
+
+ public:
+  // Param warmUpSampleCount: the number of samples of each metric taken first which are ignored
+  explicit GrowthTracker(const unsigned int warmUpSampleCount);
+
+  // Param name: it must not contain any whitespace
+  void add(const string& name, const double value);
+
+  // Param name: it must have been added
+  // Return: whether the metric given keeps going up
+  bool isGrowing(const string& name) const;
+
+  // Writes the first and the last value after warming up and the trend of every metric, 1 metric per line.
+  // Return: the number of metrics which keep going up
+  unsigned int report(ostream&) const;
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_GROWTHTRACKER_H_
@@ -0,0 +1,59 @@
+// Copyright ii887522
+
+#include "Histogram.h"
+#include <ostream>
+#include <algorithm>
+
+using std::ostream;
+using std::min;
+
+namespace ii887522::snake {
+
+Histogram::Histogram() : counts{ }, count{ 0u }, max{ 0ull }, sum{ 0ull } { }
+
+unsigned int Histogram::getBucketIndex(const unsigned long long value) {
+  if (value < LINEAR_BUCKET_COUNT) return static_cast<unsigned int>(value);
+  auto exponent{ 0u };
+  while (value >> (exponent + 1u)) ++exponent;
+  const auto subBucketIndex{ static_cast<unsigned int>(value >> (exponent - 3u)) & (SUB_BUCKET_COUNT - 1u) };
+  return min(LINEAR_BUCKET_COUNT + (exponent - 4u) * SUB_BUCKET_COUNT + subBucketIndex, BUCKET_COUNT - 1u);
+}
+
+unsigned long long Histogram::getBucketEnd(const unsigned int bucketIndex) {
+  if (bucketIndex < LINEAR_BUCKET_COUNT) return bucketIndex + 1ull;
+  const auto exponent{ (bucketIndex - LINEAR_BUCKET_COUNT) / SUB_BUCKET_COUNT + 4u };
+  const auto subBucketIndex{ (bucketIndex - LINEAR_BUCKET_COUNT) % SUB_BUCKET_COUNT };
+  return (1ull << exponent) + ((subBucketIndex + 1ull) << (exponent - 3u));
+}
+
+void Histogram::add(const unsigned long long value) {
+  ++counts[getBucketIndex(value)];
+  ++count;
+  if (value > max) max = value;
+  sum += value;
+}
+
+unsigned long long Histogram::getPercentile(const double percentile) const {
+  if (count == 0u) return 0ull;
+  const auto rank{ static_cast<unsigned int>(count * percentile / 100. + .5) };
+  auto cumulativeCount{ 0u };
+  for (auto i{ 0u }; i != BUCKET_COUNT; ++i) {
+    cumulativeCount += counts[i];
+    if (cumulativeCount >= rank && cumulativeCount != 0u) return min(getBucketEnd(i), max);
+  }
+  return max;
+}
+
+void Histogram::reset() {
+  counts.fill(0u);
+  count = 0u;
+  max = 0ull;
+  sum = 0ull;
+}
+
+void Histogram::writeJson(ostream& stream) const {
+  stream << "{ \"count\": " << count << ", \"p50Us\": " << getPercentile(50.) << ", \"p99Us\": " << getPercentile(99.) <<
+    ", \"maxUs\": " << max << ", \"meanUs\": " << getMean() << " }";
+}
+
+}  // namespace ii887522::snake
@@ -0,0 +1,62 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_HISTOGRAM_H_
+#define SNAKE_SRC_MAIN_ANY_HISTOGRAM_H_
+
+#include <array>
+#include <ostream>
+
+using std::array;
+using std::ostream;
+
+namespace ii887522::snake {
+
+// It is a fixed-bucket latency histogram in microseconds. Values below 16 microseconds get 1 bucket each, every power of 2 above
+// that is split into 8 buckets, so percentiles are accurate to within 12.5% while adding a value never allocates.
+// Not Thread Safe
+class Histogram final {
+  static constexpr auto LINEAR_BUCKET_COUNT{ 16u };
+  static constexpr auto SUB_BUCKET_COUNT{ 8u };
+  static constexpr auto BUCKET_COUNT{ LINEAR_BUCKET_COUNT + 28u * SUB_BUCKET_COUNT };
+
+  array<unsigned int, BUCKET_COUNT> counts;
+  unsigned int count;
+  unsigned long long max;
+  unsigned long long sum;
+
+  static unsigned int getBucketIndex(const unsigned long long value);
+
+  // Return: the smallest value which does not belong to the bucket given
+  static unsigned long long getBucketEnd(const unsigned int bucketIndex);
+
+ public:
+  explicit Histogram();
+
+  constexpr unsigned int getCount() const {
+    return count;
+  }
+
+  constexpr unsigned long long getMax() const {
+    return max;
+  }
+
+  constexpr unsigned long long getMean() const {
+    return count == 0u ? 0ull : sum / count;
+  }
+
+  // Param value: it is in microseconds
+  void add(const unsigned long long value);
+
+  // Param percentile: it must be in the range of 0 to 100
+  // Return: an upper bound of the percentile given in microseconds
+  unsigned long long getPercentile(const double percentile) const;
+
+  void reset();
+
+  // Writes count, p50, p99, max and mean as a JSON object.
+  void writeJson(ostream&) const;
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_HISTOGRAM_H_
@@ -0,0 +1,49 @@
+// Copyright ii887522
+
+#include "HitIndex.h"
+#include <SDL.h>
+#include <vector>
+#include <algorithm>
+
+using std::vector;
+using std::min;
+using std::max;
+
+namespace ii887522::snake {
+
+HitIndex::HitIndex(const vector<SDL_Rect>& rects) : rects{ rects }, bounds{ 0, 0, 0, 0 } {
+  if (rects.empty()) return;
+  auto left{ toBucket(rects.front().x) };
+  auto top{ toBucket(rects.front().y) };
+  auto right{ toBucket(rects.front().x + rects.front().w - 1) };
+  auto bottom{ toBucket(rects.front().y + rects.front().h - 1) };
+  for (const auto& rect : rects) {
+    left = min(toBucket(rect.x), left);
+    top = min(toBucket(rect.y), top);
+    right = max(toBucket(rect.x + rect.w - 1), right);
+    bottom = max(toBucket(rect.y + rect.h - 1), bottom);
+  }
+  bounds = SDL_Rect{ left, top, right - left + 1, bottom - top + 1 };
+  buckets.resize(static_cast<unsigned int>(bounds.w * bounds.h));
+  for (auto i{ 0u }; i != rects.size(); ++i) {
+    const auto& rect{ rects[i] };
+    for (auto y{ toBucket(rect.y) }; y <= toBucket(rect.y + rect.h - 1); ++y) {
+      for (auto x{ toBucket(rect.x) }; x <= toBucket(rect.x + rect.w - 1); ++x) {
+        buckets[static_cast<unsigned int>((y - bounds.y) * bounds.w + x - bounds.x)].push_back(i);
+      }
+    }
+  }
+}
+
+void HitIndex::find(const SDL_Point& point, vector<unsigned int>*const result) const {
+  result->clear();
+  const auto x{ toBucket(point.x) - bounds.x };
+  const auto y{ toBucket(point.y) - bounds.y };
+  if (x < 0 || y < 0 || x >= bounds.w || y >= bounds.h) return;
+  for (const auto i : buckets[static_cast<unsigned int>(y * bounds.w + x)]) {
+    const auto& rect{ rects[i] };
+    if (point.x >= rect.x && point.y >= rect.y && point.x < rect.x + rect.w && point.y < rect.y + rect.h) result->push_back(i);
+  }
+}
+
+}  // namespace ii887522::snake
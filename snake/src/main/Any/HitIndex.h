@@ -0,0 +1,47 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_HITINDEX_H_
+#define SNAKE_SRC_MAIN_ANY_HITINDEX_H_
+
+#include <SDL.h>
+#include <vector>
+
+using std::vector;
+
+namespace ii887522::snake {
+
+// It finds the regions containing a point without testing every region. The area covered by the regions is divided into square
+// buckets, and each region is put into every bucket it overlaps, so a point is only tested against the regions in its bucket.
+// Not Thread Safe
+class HitIndex final {
+  // remove copy semantics
+  HitIndex(const HitIndex&) = delete;
+  HitIndex& operator=(const HitIndex&) = delete;
+
+  // remove move semantics
+  HitIndex(HitIndex&&) = delete;
+  HitIndex& operator=(HitIndex&&) = delete;
+
+  static constexpr auto BUCKET_SIZE{ 64 };  // in pixels
+
+  const vector<SDL_Rect> rects;
+  SDL_Rect bounds;  // in buckets
+  vector<vector<unsigned int>> buckets;  // the indices of the regions overlapping each bucket in ascending order
+
+  // Param value: in pixels
+  // Return: the bucket the value falls into, rounding down for negative values as well
+  static constexpr int toBucket(const int value) {
+    return value >= 0 ? value / BUCKET_SIZE : -((-value + BUCKET_SIZE - 1) / BUCKET_SIZE);
+  }
+
+ public:
+  // Param rects: the regions to index, each of them is identified by its index
+  explicit HitIndex(const vector<SDL_Rect>& rects);
+
+  // Param result: the indices of the regions containing the point given are stored into it in ascending order
+  void find(const SDL_Point&, vector<unsigned int>*const result) const;
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_HITINDEX_H_
@@ -0,0 +1,54 @@
+// Copyright ii887522
+
+#include "IdleMonitor.h"
+#include <SDL.h>
+#include <functional>
+#include "../Functions/trace.h"
+
+using std::function;
+
+namespace ii887522::snake {
+
+// Compare SDL ticks in a way which survives them wrapping around
+static constexpr bool isBefore(const Uint32 left, const Uint32 right) {
+  return static_cast<Sint32>(left - right) < 0;
+}
+
+IdleMonitor::IdleMonitor(const unsigned int graceDuration, const unsigned int maxWaitDuration) : graceDuration{ graceDuration },
+  maxWaitDuration{ maxWaitDuration }, awakeUntil{ SDL_GetTicks() + graceDuration }, resumedAt{ 0u }, hasWaited{ false } { }
+
+void IdleMonitor::addActivity(const function<bool()>& isActive) {
+  activities.push_back(isActive);
+}
+
+void IdleMonitor::keepAwakeFor(const unsigned int duration) {
+  const auto until{ SDL_GetTicks() + duration };
+  if (isBefore(awakeUntil, until)) awakeUntil = until;
+}
+
+bool IdleMonitor::isAnyActive() const {
+  for (const auto& isActive : activities) {
+    if (isActive()) return true;
+  }
+  return false;
+}
+
+void IdleMonitor::waitIfIdle() {
+  if (maxWaitDuration == 0u) return;
+  if (isAnyActive()) keepAwakeFor(graceDuration);
+  if (isBefore(SDL_GetTicks(), awakeUntil)) return;
+  traceInstant("idle", "frame");
+  // Passing nullptr only waits for an event without taking it out of the queue
+  SDL_WaitEventTimeout(nullptr, static_cast<int>(maxWaitDuration));
+  resumedAt = SDL_GetTicks();
+  hasWaited = true;
+}
+
+unsigned int IdleMonitor::clampDt(const unsigned int dt) {
+  if (!hasWaited) return dt;
+  hasWaited = false;
+  const auto elapsed{ SDL_GetTicks() - resumedAt };
+  return elapsed < dt ? elapsed : dt;
+}
+
+}  // namespace ii887522::snake
@@ -0,0 +1,61 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_IDLEMONITOR_H_
+#define SNAKE_SRC_MAIN_ANY_IDLEMONITOR_H_
+
+#include <SDL.h>
+#include <functional>
+#include <vector>
+
+using std::function;
+using std::vector;
+
+namespace ii887522::snake {
+
+// It decides when nothing on screen can change until the next input, so the frame loop can block on SDL_WaitEventTimeout()
+// instead of spinning. The app is busy while any activity added is active, and for a grace duration after that so that fades
+// triggered by it can finish. Input and explicit keepAwakeFor() calls also end idling.
+// Not Thread Safe: it must only be used in main thread
+class IdleMonitor final {
+  // remove copy semantics
+  IdleMonitor(const IdleMonitor&) = delete;
+  IdleMonitor& operator=(const IdleMonitor&) = delete;
+
+  // remove move semantics
+  IdleMonitor(IdleMonitor&&) = delete;
+  IdleMonitor& operator=(IdleMonitor&&) = delete;
+
+  const unsigned int graceDuration;
+  const unsigned int maxWaitDuration;
+  vector<function<bool()>> activities;
+  Uint32 awakeUntil;  // the time in SDL ticks until which the app must not idle
+  Uint32 resumedAt;  // the time in SDL ticks the last wait ended
+  bool hasWaited;  // whether the app has idled since clampDt() was last called
+
+  bool isAnyActive() const;
+
+ public:
+  // Param graceDuration: how long in milliseconds the app stays awake after it was last busy. It must cover the longest fade.
+  // Param maxWaitDuration: the longest time in milliseconds to block at once, or 0 to never idle
+  explicit IdleMonitor(const unsigned int graceDuration = 250u, const unsigned int maxWaitDuration = 1000u);
+
+  // Param isActive: it tells whether something it stands for is animating. It is called once per frame.
+  void addActivity(const function<bool()>& isActive);
+
+  // Param duration: how long in milliseconds the app must not idle from now on
+  void keepAwakeFor(const unsigned int duration);
+
+  // Blocks until an event arrives or maxWaitDuration passes if the app is idle. The event arrived is left in the queue for the
+  // event loop to handle.
+  void waitIfIdle();
+
+  // The duration of the frame after a wait includes the whole wait, which would make the animations started by the input which
+  // ended it jump to their ends. It should be called once per frame before stepping.
+  // Param dt: the duration of the frame in milliseconds
+  // Return: dt, or the time since the last wait ended if the app has idled since the last call and it is shorter
+  unsigned int clampDt(const unsigned int dt);
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_IDLEMONITOR_H_
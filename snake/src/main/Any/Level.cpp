@@ -0,0 +1,101 @@
+// Copyright ii887522
+
+#include "Level.h"
+#include <windows.h>
+#include <Struct/Point.h>
+#include <Struct/Rect.h>
+#include <string>
+#include <stdexcept>
+#include <bit>
+#include "Enums.h"
+#include "../Struct/LevelHeader.h"
+#include "../Struct/SpawnPoint.h"
+
+using std::string;
+using std::runtime_error;
+using std::popcount;
+using ii887522::viewify::Point;
+using ii887522::viewify::Rect;
+
+namespace ii887522::snake {
+
+// Return: whether the section given lies inside the file and starts on the alignment given
+static constexpr bool isSectionValid(const unsigned long long offset, const unsigned long long size,
+  const unsigned long long alignment, const unsigned long long fileSize) {
+  return offset % alignment == 0u && offset >= sizeof(LevelHeader) && offset <= fileSize && size <= fileSize - offset;
+}
+
+Level::Level(const string& filePath) : file{ CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+  FILE_ATTRIBUTE_NORMAL, nullptr) }, mapping{ nullptr }, header{ nullptr }, walls{ nullptr }, spawnPoints{ nullptr },
+  foodZones{ nullptr } {
+  if (file == INVALID_HANDLE_VALUE) throw runtime_error{ "The level file cannot be opened!" };
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(file, &fileSize) || static_cast<unsigned long long>(fileSize.QuadPart) < sizeof(LevelHeader)) {
+    fail("The level file is not in a supported format!");
+  }
+  mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0u, 0u, nullptr);
+  if (!mapping) fail("The level file cannot be mapped into memory!");
+  header = static_cast<const LevelHeader*>(MapViewOfFile(mapping, FILE_MAP_READ, 0u, 0u, 0u));
+  if (!header) fail("The level file cannot be mapped into memory!");
+  // Only the header and the sections it points to are checked, so the walls are never read here
+  const auto size{ static_cast<unsigned long long>(fileSize.QuadPart) };
+  if (header->magic != LevelHeader::MAGIC || header->version != LevelHeader::VERSION || header->boardSize.w < 3u ||
+    header->boardSize.h < 3u || header->wordsPerRow != (header->boardSize.w + 63u) >> 6u ||
+    !isSectionValid(header->wallsOffset, static_cast<unsigned long long>(header->boardSize.h) * header->wordsPerRow * 8u, 8u, size) ||
+    !isSectionValid(header->spawnPointsOffset, static_cast<unsigned long long>(header->spawnPointCount) * sizeof(SpawnPoint),
+      alignof(SpawnPoint), size) ||
+    !isSectionValid(header->foodZonesOffset, static_cast<unsigned long long>(header->foodZoneCount) * sizeof(Rect<unsigned int>),
+      alignof(Rect<unsigned int>), size)) {
+    fail("The level file is not in a supported format!");
+  }
+  const auto data{ reinterpret_cast<const char*>(header) };
+  walls = reinterpret_cast<const unsigned long long*>(data + header->wallsOffset);
+  spawnPoints = reinterpret_cast<const SpawnPoint*>(data + header->spawnPointsOffset);
+  foodZones = reinterpret_cast<const Rect<unsigned int>*>(data + header->foodZonesOffset);
+  for (auto i{ 0u }; i != header->spawnPointCount; ++i) {
+    const auto& spawnPoint{ spawnPoints[i] };
+    if (spawnPoint.position.x == 0u || spawnPoint.position.y == 0u || spawnPoint.position.x >= header->boardSize.w - 1u ||
+      spawnPoint.position.y >= header->boardSize.h - 1u || spawnPoint.direction >= Direction::COUNT) {
+      fail("The level file has a spawn point outside the board!");
+    }
+    if (isWall(spawnPoint.position)) fail("The level file has a spawn point on a wall!");
+  }
+  for (auto i{ 0u }; i != header->foodZoneCount; ++i) {
+    const auto& foodZone{ foodZones[i] };
+    if (foodZone.position.x == 0u || foodZone.position.y == 0u || foodZone.size.w == 0u || foodZone.size.h == 0u ||
+      foodZone.size.w > header->boardSize.w - 1u - foodZone.position.x ||
+      foodZone.size.h > header->boardSize.h - 1u - foodZone.position.y) {
+      fail("The level file has a food zone outside the board!");
+    }
+  }
+}
+
+void Level::fail(const char*const message) {
+  if (header) UnmapViewOfFile(header);
+  if (mapping) CloseHandle(mapping);
+  CloseHandle(file);
+  throw runtime_error{ message };
+}
+
+unsigned int Level::getInnerWallCount() const {
+  const auto& boardSize{ header->boardSize };
+  // Bits past the last column of a row are not cells, so they are left out whatever the file holds
+  const auto lastWordMask{ (boardSize.w & 63u) == 0u ? ~0ull : (1ull << (boardSize.w & 63u)) - 1ull };
+  auto result{ 0u };
+  // Counting whole words is much faster than counting cells, and the border is taken out afterwards
+  for (auto y{ 1u }; y != boardSize.h - 1u; ++y) {
+    const auto row{ walls + static_cast<unsigned long long>(y) * header->wordsPerRow };
+    for (auto i{ 0u }; i != header->wordsPerRow - 1u; ++i) result += static_cast<unsigned int>(popcount(row[i]));
+    result += static_cast<unsigned int>(popcount(row[header->wordsPerRow - 1u] & lastWordMask));
+    result -= static_cast<unsigned int>(isWall(Point{ 0u, y })) + static_cast<unsigned int>(isWall(Point{ boardSize.w - 1u, y }));
+  }
+  return result;
+}
+
+Level::~Level() {
+  UnmapViewOfFile(header);
+  CloseHandle(mapping);
+  CloseHandle(file);
+}
+
+}  // namespace ii887522::snake
@@ -0,0 +1,84 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_LEVEL_H_
+#define SNAKE_SRC_MAIN_ANY_LEVEL_H_
+
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <Struct/Rect.h>
+#include <string>
+#include "../Struct/LevelHeader.h"
+#include "../Struct/SpawnPoint.h"
+
+using std::string;
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+using ii887522::viewify::Rect;
+
+namespace ii887522::snake {
+
+// It is a board layout with walls inside the border, the cells a new snake may be born in and the regions food spawns in. The
+// level file is mapped into memory and read in place, so opening a huge maze takes no longer than opening a small one.
+// See also ../Struct/LevelHeader.h and LevelWriter.h for more details
+// Not Thread Safe
+class Level final {
+  // remove copy semantics
+  Level(const Level&) = delete;
+  Level& operator=(const Level&) = delete;
+
+  // remove move semantics
+  Level(Level&&) = delete;
+  Level& operator=(Level&&) = delete;
+
+  // They are handles, which are kept opaque so that windows.h is not pulled into every file which includes this file
+  void* file;
+  void* mapping;
+  const LevelHeader* header;
+  const unsigned long long* walls;
+  const SpawnPoint* spawnPoints;
+  const Rect<unsigned int>* foodZones;
+
+  // Unmaps the file and throws the message given.
+  [[noreturn]] void fail(const char*const message);
+
+ public:
+  explicit Level(const string& filePath);
+
+  constexpr const Size<unsigned int>& getBoardSize() const {
+    return header->boardSize;
+  }
+
+  // Param position: it must be inside the board
+  // Return: whether the cell is a wall of the layout, the border is not counted unless the layout says so
+  constexpr bool isWall(const Point<unsigned int>& position) const {
+    return walls[static_cast<unsigned long long>(position.y) * header->wordsPerRow + (position.x >> 6u)] >> (position.x & 63u) & 1u;
+  }
+
+  // Return: the number of walls inside the border. It reads the whole wall bitmap, so it should not be called often
+  unsigned int getInnerWallCount() const;
+
+  constexpr unsigned int getSpawnPointCount() const {
+    return header->spawnPointCount;
+  }
+
+  // Param index: it must be less than getSpawnPointCount()
+  constexpr const SpawnPoint& getSpawnPoint(const unsigned int index) const {
+    return spawnPoints[index];
+  }
+
+  constexpr unsigned int getFoodZoneCount() const {
+    return header->foodZoneCount;
+  }
+
+  // Param index: it must be less than getFoodZoneCount()
+  // Return: the cells food may spawn in, which are all inside the border
+  constexpr const Rect<unsigned int>& getFoodZone(const unsigned int index) const {
+    return foodZones[index];
+  }
+
+  ~Level();
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_LEVEL_H_
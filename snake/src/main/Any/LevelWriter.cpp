@@ -0,0 +1,55 @@
+// Copyright ii887522
+
+#include "LevelWriter.h"
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <Struct/Rect.h>
+#include <string>
+#include <vector>
+#include <fstream>
+#include "../Struct/LevelHeader.h"
+#include "../Struct/SpawnPoint.h"
+#include "../Functions/stream_ext.h"
+
+using std::string;
+using std::vector;
+using std::ofstream;
+using std::ios;
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+using ii887522::viewify::Rect;
+
+namespace ii887522::snake {
+
+LevelWriter::LevelWriter(const Size<unsigned int>& boardSize) : boardSize{ boardSize }, wordsPerRow{ (boardSize.w + 63u) >> 6u },
+  walls(static_cast<unsigned long long>(boardSize.h) * wordsPerRow, 0ull) { }
+
+void LevelWriter::setWall(const Point<unsigned int>& position) {
+  walls[static_cast<unsigned long long>(position.y) * wordsPerRow + (position.x >> 6u)] |= 1ull << (position.x & 63u);
+}
+
+void LevelWriter::addSpawnPoint(const SpawnPoint& spawnPoint) {
+  spawnPoints.push_back(spawnPoint);
+}
+
+void LevelWriter::addFoodZone(const Rect<unsigned int>& foodZone) {
+  foodZones.push_back(foodZone);
+}
+
+bool LevelWriter::write(const string& filePath) const {
+  ofstream file{ filePath, ios::binary | ios::trunc };
+  const auto wallsOffset{ static_cast<unsigned long long>(sizeof(LevelHeader)) };
+  const auto spawnPointsOffset{ wallsOffset + walls.size() * sizeof(unsigned long long) };
+  const auto foodZonesOffset{ spawnPointsOffset + spawnPoints.size() * sizeof(SpawnPoint) };
+  ii887522::snake::write(file, LevelHeader{
+    LevelHeader::MAGIC, LevelHeader::VERSION, boardSize, wordsPerRow, static_cast<unsigned int>(spawnPoints.size()),
+    static_cast<unsigned int>(foodZones.size()), 0u, wallsOffset, spawnPointsOffset, foodZonesOffset
+  });
+  file.write(reinterpret_cast<const char*>(walls.data()), walls.size() * sizeof(unsigned long long));
+  file.write(reinterpret_cast<const char*>(spawnPoints.data()), spawnPoints.size() * sizeof(SpawnPoint));
+  file.write(reinterpret_cast<const char*>(foodZones.data()), foodZones.size() * sizeof(Rect<unsigned int>));
+  file.close();
+  return static_cast<bool>(file);
+}
+
+}  // namespace ii887522::snake
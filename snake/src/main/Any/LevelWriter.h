@@ -0,0 +1,59 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_LEVELWRITER_H_
+#define SNAKE_SRC_MAIN_ANY_LEVELWRITER_H_
+
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <Struct/Rect.h>
+#include <string>
+#include <vector>
+#include "../Struct/SpawnPoint.h"
+
+using std::string;
+using std::vector;
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+using ii887522::viewify::Rect;
+
+namespace ii887522::snake {
+
+// It builds a level and writes it into a level file which can be opened by Level.
+// See also ../Struct/LevelHeader.h for more details
+// Not Thread Safe
+class LevelWriter final {
+  // remove copy semantics
+  LevelWriter(const LevelWriter&) = delete;
+  LevelWriter& operator=(const LevelWriter&) = delete;
+
+  // remove move semantics
+  LevelWriter(LevelWriter&&) = delete;
+  LevelWriter& operator=(LevelWriter&&) = delete;
+
+  const Size<unsigned int> boardSize;
+  const unsigned int wordsPerRow;
+  vector<unsigned long long> walls;
+  vector<SpawnPoint> spawnPoints;
+  vector<Rect<unsigned int>> foodZones;
+
+ public:
+  // Param boardSize: the number of cells on each side of the board including the border, each side must be at least 3 cells
+  explicit LevelWriter(const Size<unsigned int>& boardSize);
+
+  // Param position: it must be inside the board
+  void setWall(const Point<unsigned int>& position);
+
+  // Param spawnPoint: its position must be inside the border
+  void addSpawnPoint(const SpawnPoint& spawnPoint);
+
+  // Param foodZone: it must be inside the border
+  void addFoodZone(const Rect<unsigned int>& foodZone);
+
+  // Param filePath: the file will be overwritten
+  // Return: whether the level has been written
+  bool write(const string& filePath) const;
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_LEVELWRITER_H_
@@ -0,0 +1,214 @@
+// Copyright ii887522
+
+#include "MazeGenerator.h"
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <Struct/Rect.h>
+#include <vector>
+#include <algorithm>
+#include "Enums.h"
+#include "LevelWriter.h"
+#include "../Struct/SpawnPoint.h"
+#include "../Functions/random_ext.h"
+
+using std::vector;
+using std::min;
+using std::fill;
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+using ii887522::viewify::Rect;
+
+namespace ii887522::snake {
+
+MazeGenerator::MazeGenerator(const Size<unsigned int>& boardSize, const unsigned int corridorWidth,
+  const unsigned int snakeLength) : boardSize{ boardSize }, corridorWidth{ corridorWidth }, snakeLength{ snakeLength },
+  walls(boardSize.w * boardSize.h), freeCount{ 0u }, visits(boardSize.w * boardSize.h), visit{ 0u },
+  wallSums((boardSize.w + 1u) * (boardSize.h + 1u)) { }
+
+Rect<unsigned int> MazeGenerator::grow(const Rect<unsigned int>& region, const unsigned int margin) const {
+  const auto left{ region.position.x > margin ? region.position.x - margin : 0u };
+  const auto top{ region.position.y > margin ? region.position.y - margin : 0u };
+  const auto right{ min(region.position.x + region.size.w + margin, boardSize.w) };
+  const auto bottom{ min(region.position.y + region.size.h + margin, boardSize.h) };
+  return Rect{ Point{ left, top }, Size{ right - left, bottom - top } };
+}
+
+void MazeGenerator::sumWalls(const Rect<unsigned int>& region) {
+  const auto stride{ region.size.w + 1u };
+  fill(wallSums.begin(), wallSums.begin() + stride, 0u);
+  for (auto y{ 0u }; y != region.size.h; ++y) {
+    wallSums[(y + 1u) * stride] = 0u;
+    for (auto x{ 0u }; x != region.size.w; ++x) {
+      wallSums[(y + 1u) * stride + x + 1u] = walls[getIndex(region.position.x + x, region.position.y + y)] +
+        wallSums[y * stride + x + 1u] + wallSums[(y + 1u) * stride + x] - wallSums[y * stride + x];
+    }
+  }
+}
+
+bool MazeGenerator::isSquareFree(const Rect<unsigned int>& region, const Point<unsigned int>& position) const {
+  const auto stride{ region.size.w + 1u };
+  const auto left{ position.x - region.position.x };
+  const auto top{ position.y - region.position.y };
+  const auto right{ left + corridorWidth };
+  const auto bottom{ top + corridorWidth };
+  return wallSums[bottom * stride + right] - wallSums[top * stride + right] - wallSums[bottom * stride + left] +
+    wallSums[top * stride + left] == 0u;
+}
+
+bool MazeGenerator::isWideEnough(const Rect<unsigned int>& region) {
+  // Every square which may cover a cell of the region lies in it grown by the corridor width minus 1
+  const auto summedRegion{ grow(region, corridorWidth - 1u) };
+  sumWalls(summedRegion);
+  for (auto y{ region.position.y }; y != region.position.y + region.size.h; ++y) {
+    for (auto x{ region.position.x }; x != region.position.x + region.size.w; ++x) {
+      if (walls[getIndex(x, y)]) continue;
+      auto isCovered{ false };
+      const auto top{ y + 1u > summedRegion.position.y + corridorWidth ? y + 1u - corridorWidth : summedRegion.position.y };
+      const auto left{ x + 1u > summedRegion.position.x + corridorWidth ? x + 1u - corridorWidth : summedRegion.position.x };
+      const auto bottom{ summedRegion.position.y + summedRegion.size.h };
+      const auto right{ summedRegion.position.x + summedRegion.size.w };
+      for (auto squareY{ top }; !isCovered && squareY <= y && squareY + corridorWidth <= bottom; ++squareY) {
+        for (auto squareX{ left }; squareX <= x && squareX + corridorWidth <= right; ++squareX) {
+          if (!isSquareFree(summedRegion, Point{ squareX, squareY })) continue;
+          isCovered = true;
+          break;
+        }
+      }
+      if (!isCovered) return false;
+    }
+  }
+  return true;
+}
+
+unsigned int MazeGenerator::search(const Rect<unsigned int>& region, const unsigned int cellIndex) {
+  // Each search marks the cells it visits with its own number, so the marks never have to be cleared except on wrapping around
+  if (++visit == 0u) {
+    fill(visits.begin(), visits.end(), 0u);
+    visit = 1u;
+  }
+  visits[cellIndex] = visit;
+  pendingCells.clear();
+  pendingCells.push_back(cellIndex);
+  auto result{ 1u };
+  while (!pendingCells.empty()) {
+    const auto index{ pendingCells.back() };
+    pendingCells.pop_back();
+    const auto x{ index % boardSize.w };
+    const auto y{ index / boardSize.w };
+    const unsigned int neighborIndices[]{
+      y > region.position.y ? index - boardSize.w : index,
+      x + 1u < region.position.x + region.size.w ? index + 1u : index,
+      y + 1u < region.position.y + region.size.h ? index + boardSize.w : index,
+      x > region.position.x ? index - 1u : index
+    };
+    for (const auto neighborIndex : neighborIndices) {
+      if (walls[neighborIndex] || visits[neighborIndex] == visit) continue;
+      visits[neighborIndex] = visit;
+      pendingCells.push_back(neighborIndex);
+      ++result;
+    }
+  }
+  return result;
+}
+
+bool MazeGenerator::isConnected(const Rect<unsigned int>& region, const vector<unsigned int>& cells) {
+  if (cells.empty()) return true;
+  search(region, cells.front());
+  for (const auto cellIndex : cells) {
+    if (visits[cellIndex] != visit) return false;
+  }
+  return true;
+}
+
+bool MazeGenerator::tryAddBlock(const Rect<unsigned int>& block) {
+  blockCells.clear();
+  for (auto y{ block.position.y }; y != block.position.y + block.size.h; ++y) {
+    for (auto x{ block.position.x }; x != block.position.x + block.size.w; ++x) {
+      if (walls[getIndex(x, y)]) continue;
+      walls[getIndex(x, y)] = 1u;
+      blockCells.push_back(getIndex(x, y));
+    }
+  }
+  borderingCells.clear();
+  for (const auto cellIndex : blockCells) {
+    for (const auto neighborIndex : { cellIndex - boardSize.w, cellIndex + 1u, cellIndex + boardSize.w, cellIndex - 1u }) {
+      if (!walls[neighborIndex]) borderingCells.push_back(neighborIndex);
+    }
+  }
+  // A block which walls off no cell, leaves no room for the snake or swallows the last free cells around it is never kept
+  if (
+    blockCells.empty() || freeCount - static_cast<unsigned int>(blockCells.size()) <= snakeLength || borderingCells.empty() ||
+    !isConnected(grow(block, corridorWidth + 1u), borderingCells) || !isWideEnough(grow(block, corridorWidth - 1u))
+  ) {
+    for (const auto cellIndex : blockCells) walls[cellIndex] = 0u;
+    return false;
+  }
+  freeCount -= static_cast<unsigned int>(blockCells.size());
+  return true;
+}
+
+void MazeGenerator::addSpawnPoints(unsigned long long*const randomState) {
+  constexpr Point<int> offsets[]{ Point{ 0, -1 }, Point{ 1, 0 }, Point{ 0, 1 }, Point{ -1, 0 } };
+  spawnPoints.clear();
+  // A new snake must not run into a wall on its first move
+  for (auto i{ 0u }; i != SPAWN_POINT_COUNT << 6u && spawnPoints.size() != SPAWN_POINT_COUNT; ++i) {
+    const Point position{ 1u + nextRandom(randomState, boardSize.w - 2u), 1u + nextRandom(randomState, boardSize.h - 2u) };
+    const auto direction{ nextRandom(randomState, static_cast<unsigned int>(Direction::COUNT)) };
+    if (
+      walls[getIndex(position.x, position.y)] ||
+      walls[getIndex(position.x + offsets[direction].x, position.y + offsets[direction].y)]
+    ) {
+      continue;
+    }
+    spawnPoints.push_back(SpawnPoint{ position, static_cast<Direction>(direction) });
+  }
+}
+
+void MazeGenerator::generate(const unsigned long long seed, const float wallRatio) {
+  for (auto y{ 0u }; y != boardSize.h; ++y) {
+    for (auto x{ 0u }; x != boardSize.w; ++x) {
+      walls[getIndex(x, y)] = x == 0u || y == 0u || x == boardSize.w - 1u || y == boardSize.h - 1u;
+    }
+  }
+  const auto innerCellCount{ (boardSize.w - 2u) * (boardSize.h - 2u) };
+  freeCount = innerCellCount;
+  const auto wallCount{ static_cast<unsigned int>(innerCellCount * wallRatio) };
+  // The sides of blocks are spread evenly, so a block covers about a quarter of the square of the largest side plus 1 on average
+  const auto attemptCount{ ATTEMPT_RATIO * (wallCount / ((MAX_BLOCK_SIDE + 1u) * (MAX_BLOCK_SIDE + 1u) >> 2u) + 1u) };
+  auto randomState{ seed };
+  for (auto i{ 0u }; i != attemptCount && innerCellCount - freeCount < wallCount; ++i) {
+    const Point position{ 1u + nextRandom(&randomState, boardSize.w - 2u), 1u + nextRandom(&randomState, boardSize.h - 2u) };
+    const Size size{
+      min(1u + nextRandom(&randomState, MAX_BLOCK_SIDE), boardSize.w - 1u - position.x),
+      min(1u + nextRandom(&randomState, MAX_BLOCK_SIDE), boardSize.h - 1u - position.y)
+    };
+    tryAddBlock(Rect{ position, size });
+  }
+  addSpawnPoints(&randomState);
+}
+
+bool MazeGenerator::validate() {
+  if (spawnPoints.empty()) return false;
+  auto actualFreeCount{ 0u };
+  auto firstFreeIndex{ 0u };
+  for (auto i{ 0u }; i != walls.size(); ++i) {
+    if (walls[i]) continue;
+    if (actualFreeCount == 0u) firstFreeIndex = i;
+    ++actualFreeCount;
+  }
+  if (actualFreeCount <= snakeLength) return false;
+  const Rect board{ Point{ 0u, 0u }, boardSize };
+  if (search(board, firstFreeIndex) != actualFreeCount) return false;
+  return isWideEnough(Rect{ Point{ 1u, 1u }, Size{ boardSize.w - 2u, boardSize.h - 2u } });
+}
+
+void MazeGenerator::write(LevelWriter*const levelWriter) const {
+  for (auto y{ 1u }; y != boardSize.h - 1u; ++y) {
+    for (auto x{ 1u }; x != boardSize.w - 1u; ++x) {
+      if (walls[getIndex(x, y)]) levelWriter->setWall(Point{ x, y });
+    }
+  }
+  for (const auto& spawnPoint : spawnPoints) levelWriter->addSpawnPoint(spawnPoint);
+}
+
+}  // namespace ii887522::snake
@@ -0,0 +1,111 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_MAZEGENERATOR_H_
+#define SNAKE_SRC_MAIN_ANY_MAZEGENERATOR_H_
+
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <Struct/Rect.h>
+#include <vector>
+#include "LevelWriter.h"
+#include "../Struct/SpawnPoint.h"
+
+using std::vector;
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+using ii887522::viewify::Rect;
+
+namespace ii887522::snake {
+
+// It scatters blocks of walls inside the border of a board at random. A block is only kept if every free cell is still reachable
+// from every other one and still inside a free square as wide as the corridor width, so that a snake can get anywhere on the
+// board and turn around wherever it is. Both are checked only around the block: if the free cells touching it are still
+// connected to each other, every path that went through it can go around it instead. So a block costs the same to check however
+// large the board is, and validate() checks the whole layout again from scratch afterwards.
+// See also LevelWriter.h for more details
+// Not Thread Safe: each thread must use its own generator
+class MazeGenerator final {
+  // remove copy semantics
+  MazeGenerator(const MazeGenerator&) = delete;
+  MazeGenerator& operator=(const MazeGenerator&) = delete;
+
+  // remove move semantics
+  MazeGenerator(MazeGenerator&&) = delete;
+  MazeGenerator& operator=(MazeGenerator&&) = delete;
+
+  static constexpr auto MAX_BLOCK_SIDE{ 6u };  // in cells
+  static constexpr auto ATTEMPT_RATIO{ 4u };  // the number of blocks tried for each block needed before giving up
+  static constexpr auto SPAWN_POINT_COUNT{ 4u };
+
+  const Size<unsigned int> boardSize;
+  const unsigned int corridorWidth;
+  const unsigned int snakeLength;
+  vector<unsigned char> walls;  // 1 for each wall including the border, row by row
+  unsigned int freeCount;
+  vector<SpawnPoint> spawnPoints;
+
+  // They are reused by every search so that checking a block allocates nothing
+  vector<unsigned int> visits;  // the search which visited each cell last
+  unsigned int visit;
+  vector<unsigned int> pendingCells;
+  vector<unsigned int> borderingCells;  // the free cells next to the block being checked
+  vector<unsigned int> wallSums;  // the number of walls above and to the left of each corner of a region
+  vector<unsigned int> blockCells;
+
+  constexpr unsigned int getIndex(const unsigned int x, const unsigned int y) const {
+    return y * boardSize.w + x;
+  }
+
+  // Return: the region given grown by the margin given on each side and cut to the board
+  Rect<unsigned int> grow(const Rect<unsigned int>& region, const unsigned int margin) const;
+
+  // Counts the walls of the region given into wallSums, so that the walls of any rectangle in it can be counted in constant time.
+  void sumWalls(const Rect<unsigned int>& region);
+
+  // Param region: the region most recently given to sumWalls()
+  // Param position: the top left corner of the square, which must be inside the region together with the whole square
+  // Return: whether the square of the corridor width there has no walls
+  bool isSquareFree(const Rect<unsigned int>& region, const Point<unsigned int>& position) const;
+
+  // Param region: the free cells in it are checked, it must be at least the corridor width minus 1 away from the border
+  // Return: whether every free cell in the region is inside a free square of the corridor width
+  bool isWideEnough(const Rect<unsigned int>& region);
+
+  // Visits every free cell which can be reached from the cell given without leaving the region given.
+  // Param cellIndex: it must be a free cell in the region
+  // Return: the number of cells visited
+  unsigned int search(const Rect<unsigned int>& region, const unsigned int cellIndex);
+
+  // Param region: the search never leaves it
+  // Return: whether every cell in cells can be reached from the first of them without leaving the region
+  bool isConnected(const Rect<unsigned int>& region, const vector<unsigned int>& cells);
+
+  // Walls the block given if the free cells stay connected and wide enough, otherwise it leaves the board as it was.
+  // Return: whether the block has been walled
+  bool tryAddBlock(const Rect<unsigned int>& block);
+
+  void addSpawnPoints(unsigned long long*const randomState);
+
+ public:
+  // Param boardSize: the number of cells on each side of the board including the border. Each side must be at least the corridor
+  //   width plus 2.
+  // Param corridorWidth: the smallest width of any way between walls, it must be at least 1
+  // Param snakeLength: the length of the longest snake which must fit into the free cells
+  explicit MazeGenerator(const Size<unsigned int>& boardSize, const unsigned int corridorWidth, const unsigned int snakeLength);
+
+  // Replaces the layout with a new one. The same seed always generates the same layout.
+  // Param wallRatio: the share of cells inside the border which are tried to be walled, it must be less than 1
+  void generate(const unsigned long long seed, const float wallRatio);
+
+  // Checks the whole layout from scratch instead of trusting the checks made while generating it.
+  // Return: whether every free cell is reachable from every other one and inside a free square of the corridor width, there is
+  //   room for the snake and there is a spawn point
+  bool validate();
+
+  // Param levelWriter: it must have the board size of the generator
+  void write(LevelWriter*const levelWriter) const;
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_MAZEGENERATOR_H_
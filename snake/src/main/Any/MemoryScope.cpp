@@ -0,0 +1,19 @@
+// Copyright ii887522
+
+#include "MemoryScope.h"
+#include "Enums.h"
+#include "../Struct/MemoryUsage.h"
+#include "../Functions/accounting.h"
+
+namespace ii887522::snake {
+
+MemoryScope::MemoryScope(const MemoryCategory category) : category{ category }, beginUsage{ getThreadMemoryUsage() } { }
+
+MemoryUsage MemoryScope::end() const {
+  const auto endUsage{ getThreadMemoryUsage() };
+  const MemoryUsage result{ endUsage.bytes - beginUsage.bytes, endUsage.blockCount - beginUsage.blockCount };
+  trackAllocation(category, result);
+  return result;
+}
+
+}  // namespace ii887522::snake
@@ -0,0 +1,50 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_MEMORYSCOPE_H_
+#define SNAKE_SRC_MAIN_ANY_MEMORYSCOPE_H_
+
+#include "Enums.h"
+#include "../Struct/MemoryUsage.h"
+
+namespace ii887522::snake {
+
+// It charges the memory a piece of code leaves allocated to a category, which is how the memory allocated inside libraries that
+// cannot be given an allocator is accounted, such as the views of a modal or the faces of a font. Only the memory allocated by
+// the thread which created the scope is charged, and whatever the piece of code allocates and frees again is not.
+// See also ../Functions/accounting.h for more details
+// Not Thread Safe: it must only be used in the thread which created it
+class MemoryScope final {
+  // remove copy semantics
+  MemoryScope(const MemoryScope&) = delete;
+  MemoryScope& operator=(const MemoryScope&) = delete;
+
+  // remove move semantics
+  MemoryScope(MemoryScope&&) = delete;
+  MemoryScope& operator=(MemoryScope&&) = delete;
+
+  const MemoryCategory category;
+  const MemoryUsage beginUsage;  // the memory of the thread when the scope was created
+
+ public:
+  explicit MemoryScope(const MemoryCategory);
+
+  // Charges the memory allocated since the scope was created to its category.
+  // Return: the memory charged, it must be passed to trackFree() once the memory has been freed
+  MemoryUsage end() const;
+};
+
+// Adds the watcher given to the reactive given and charges the memory it takes to MemoryCategory::REACTIVE_WATCHERS. A watcher
+// is never removed from its reactive, so its owner frees the charge once either of them is destroyed.
+// Param usage: the memory charged is added into it, it must be passed to trackFree() by the owner of the watcher
+template <typename Reactive, typename Watcher> void watchTracked(Reactive*const reactive, const Watcher& watcher,
+  MemoryUsage*const usage) {
+  const MemoryScope memoryScope{ MemoryCategory::REACTIVE_WATCHERS };
+  reactive->watch(watcher);
+  const auto watcherUsage{ memoryScope.end() };
+  usage->bytes += watcherUsage.bytes;
+  usage->blockCount += watcherUsage.blockCount;
+}
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_MEMORYSCOPE_H_
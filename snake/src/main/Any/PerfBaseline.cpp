@@ -0,0 +1,64 @@
+// Copyright ii887522
+
+#include "PerfBaseline.h"
+#include <string>
+#include <vector>
+#include <istream>
+#include <ostream>
+#include <algorithm>
+#include <cmath>
+
+using std::string;
+using std::vector;
+using std::istream;
+using std::ostream;
+using std::nth_element;
+using std::max_element;
+using std::max;
+using std::abs;
+
+namespace ii887522::snake {
+
+PerfBaseline::PerfBaseline() : samples{ } { }
+
+double PerfBaseline::getMedian(vector<double> values) {
+  const auto middle{ values.begin() + (values.size() >> 1u) };
+  nth_element(values.begin(), middle, values.end());
+  if (values.size() & 1u) return *middle;
+  return (*middle + *max_element(values.begin(), middle)) / 2.;
+}
+
+double PerfBaseline::getSpread(const vector<double>& values) {
+  const auto median{ getMedian(values) };
+  vector<double> deviations;
+  for (const auto value : values) deviations.push_back(abs(value - median));
+  return 1.4826 * getMedian(deviations);
+}
+
+void PerfBaseline::add(const string& name, const double value) {
+  samples[name].push_back(value);
+}
+
+void PerfBaseline::write(ostream& stream) const {
+  for (const auto& [name, values] : samples) stream << name << ' ' << getMedian(values) << ' ' << getSpread(values) << '\n';
+}
+
+unsigned int PerfBaseline::compare(istream& baseline, ostream& report) const {
+  auto regressionCount{ 0u };
+  string name;
+  double baselineMedian;
+  double baselineSpread;
+  while (baseline >> name >> baselineMedian >> baselineSpread) {
+    const auto valuesIterator{ samples.find(name) };
+    if (valuesIterator == samples.end()) continue;
+    const auto median{ getMedian(valuesIterator->second) };
+    const auto limit{ baselineMedian + max(SPREAD_COUNT * baselineSpread, MIN_RELATIVE_CHANGE * baselineMedian) };
+    const auto isRegressed{ median > limit };
+    if (isRegressed) ++regressionCount;
+    report << name << ' ' << median << " (baseline " << baselineMedian << ", limit " << limit << ')' <<
+      (isRegressed ? " REGRESSED" : "") << '\n';
+  }
+  return regressionCount;
+}
+
+}  // namespace ii887522::snake
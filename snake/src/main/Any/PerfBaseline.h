@@ -0,0 +1,63 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_PERFBASELINE_H_
+#define SNAKE_SRC_MAIN_ANY_PERFBASELINE_H_
+
+#include <string>
+#include <vector>
+#include <map>
+#include <istream>
+#include <ostream>
+
+using std::string;
+using std::vector;
+using std::map;
+using std::istream;
+using std::ostream;
+
+namespace ii887522::snake {
+
+// It collects the same measurements over a few runs and tells which of them have become slower than in a baseline collected
+// earlier. Each metric is summarized by its median over the runs and its spread, which is the median absolute deviation scaled to
+// match the standard deviation of normally distributed runs. A metric regresses if its median is above the baseline median by
+// more than 3 baseline spreads and by more than 10% of the baseline median, so that neither a noisy nor a very steady baseline
+// raises false alarms.
+// Not Thread Safe
+class PerfBaseline final {
+  // remove copy semantics
+  PerfBaseline(const PerfBaseline&) = delete;
+  PerfBaseline& operator=(const PerfBaseline&) = delete;
+
+  // remove move semantics
+  PerfBaseline(PerfBaseline&&) = delete;
+  PerfBaseline& operator=(PerfBaseline&&) = delete;
+
+  static constexpr auto SPREAD_COUNT{ 3. };
+  static constexpr auto MIN_RELATIVE_CHANGE{ .1 };
+
+  map<string, vector<double>> samples;  // the values of every run of each metric
+
+  // Param values: it must not be empty
+  static double getMedian(vector<double> values);
+
+  // Param values: it must not be empty
+  static double getSpread(const vector<double>& values);
+
+ public:
+  explicit PerfBaseline();
+
+  // Param name: it must not contain any whitespace
+  void add(const string& name, const double value);
+
+  // Writes the median and the spread of every metric, 1 metric per line.
+  void write(ostream&) const;
+
+  // Param baseline: it must have been written by write()
+  // Param report: every metric found in both is compared and written into it, 1 metric per line
+  // Return: the number of metrics which have regressed
+  unsigned int compare(istream& baseline, ostream& report) const;
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_PERFBASELINE_H_
@@ -0,0 +1,151 @@
+// Copyright ii887522
+
+#ifndef TEST
+
+#include "RenderBenchmark.h"
+#include <Any/Reactive.h>
+#include <Any/View.h>
+#include <ViewGroup/Page.h>
+#include <Struct/Size.h>
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <ostream>
+#include <functional>
+#include <algorithm>
+#include <utility>
+#include <chrono>  // NOLINT(build/c++11)
+#include "Enums.h"
+#include "GlyphAtlas.h"
+#include "Histogram.h"
+#include "FrameProfiler.h"
+#include "../Factory/GamePageFactory.h"
+#include "../Factory/SnakeViewGroupFactory.h"
+#include "../Functions/steer.h"
+
+using std::ostream;
+using std::function;
+using std::max;
+using std::pair;
+using std::chrono::high_resolution_clock;
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+using ii887522::nitro::Reactive;
+using ii887522::viewify::View;
+using ii887522::viewify::Page;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+RenderBenchmark::RenderBenchmark(const Size<int>& size, const RenderBackend renderBackend) : size{ size },
+  renderBackend{ renderBackend }, surface{ SDL_CreateRGBSurfaceWithFormat(0u, size.w, size.h, 32, SDL_PIXELFORMAT_ARGB8888) },
+  renderer{ SDL_CreateSoftwareRenderer(surface) }, headAtlas{ new GlyphAtlas{ renderer, 64 } },
+  bodyAtlas{ new GlyphAtlas{ renderer, 32 } },
+  overlayAtlas{ new GlyphAtlas{ renderer, 14 } }, currentPath{ Path::GAME } {
+  for (const auto& [atlas, ptSize] : { pair{ headAtlas, 64 }, pair{ bodyAtlas, 32 }, pair{ overlayAtlas, 14 } }) {
+    // The atlas is left drawing placeholders if the font cannot be opened
+    const auto font{ TTF_OpenFont("res/main/arial.ttf", ptSize) };
+    if (!font) continue;
+    atlas->bake(font);
+    TTF_CloseFont(font);
+    atlas->upload();
+  }
+}
+
+Size<unsigned int> RenderBenchmark::getBoardSize() const {
+  // The board fits the area below the header band, the same as in the game
+  return Size{ static_cast<unsigned int>(size.w / CELL_SIZE), static_cast<unsigned int>((size.h - HEADER_HEIGHT) / CELL_SIZE) };
+}
+
+unsigned int RenderBenchmark::getBackgroundCellCount() const {
+  return (getBoardSize().w - 2u) * (getBoardSize().h - 2u);
+}
+
+void RenderBenchmark::runScenario(ostream& output, const char*const name, const unsigned int snakeLength,
+  const function<void(GamePageFactory<gamePageViewCount>& factory, View*const page, const int frameIndex)>& script) {
+  const auto factory{
+    GamePageFactory<gamePageViewCount>::Builder{ renderer, size, nullptr, &currentPath }
+      .setHeadAtlas(headAtlas)
+      .setBodyAtlas(bodyAtlas)
+      .setOverlayAtlas(overlayAtlas)
+      .setButtonDuration(125u)
+      .setButtonPadding(Size{ 20, 12 })
+      .setCellSize(CELL_SIZE)
+      // Scripted games are neither worth replaying nor comparable with stats of games played
+      .setReplayDirPath("")
+      .setStatsDirPath("")
+      .setRenderBackend(renderBackend)
+      .setSnakeLength(snakeLength)
+      .build()
+  };
+  const auto page{ factory->make() };
+  auto& profiler{ factory->getProfiler() };
+  steerAlongSerpentine(page, getBoardSize(), snakeLength);
+  Histogram frameHistogram;
+  auto maxDrawCallCount{ 0ull };
+  for (auto i{ -WARM_UP_FRAME_COUNT }; i != FRAME_COUNT; ++i) {
+    if (i == 0) profiler.reset();
+    script(*factory, page, i);
+    const auto drawCallCount{ profiler.getDrawCallCount() };
+    const auto begin{ high_resolution_clock::now() };
+    page->step(FRAME_DURATION);
+    page->checkAndReactHits(FRAME_DURATION);
+    SDL_SetRenderDrawColor(renderer, 0u, 0u, 0u, 255u);
+    SDL_RenderClear(renderer);
+    page->render();
+    SDL_RenderPresent(renderer);
+    if (i < 0) continue;
+    frameHistogram.add(duration_cast<microseconds>(high_resolution_clock::now() - begin).count());
+    maxDrawCallCount = max(profiler.getDrawCallCount() - drawCallCount, maxDrawCallCount);
+  }
+  output << "    \"" << name << "\": {\n      \"snakeLength\": " << snakeLength << ",\n      \"frame\": ";
+  frameHistogram.writeJson(output);
+  output << ",\n      \"drawCalls\": " << profiler.getDrawCallCount() << ",\n      \"maxDrawCallsPerFrame\": " << maxDrawCallCount <<
+    ",\n      \"profile\": ";
+  profiler.writeJson(output);
+  output << "    }";
+  // The profile has been written above, so it is not dumped again
+  profiler.reset();
+  delete page;
+  delete factory;
+}
+
+void RenderBenchmark::run(ostream& output) {
+  const auto cellCount{ getBackgroundCellCount() };
+  output << "{\n  \"backend\": \"" << (renderBackend == RenderBackend::SOFTWARE ? "software" : "renderer") <<
+    "\",\n  \"frameDurationMs\": " << FRAME_DURATION << ",\n  \"frames\": " << FRAME_COUNT << ",\n  \"scenarios\": {\n";
+  const auto play{ [](GamePageFactory<gamePageViewCount>&, View*const, const int) { } };
+  runScenario(output, "emptyBoard", 1u, play);
+  output << ",\n";
+  runScenario(output, "halfFullBoard", cellCount >> 1u, play);
+  output << ",\n";
+  // The score to win is 3 quarters of the cells, and the snake still has enough room ahead of it until the last frame
+  runScenario(output, "nearWinBoard", cellCount * 3u >> 2u, play);
+  output << ",\n";
+  // The losing modal fades in and out over and over again
+  runScenario(output, "modalFade", 1u, [this](GamePageFactory<gamePageViewCount>& factory, View*const page, const int frameIndex) {
+    if (frameIndex < 0) return;
+    if (frameIndex % 64 == 0) {
+      factory.setLosingModalShowing(true);
+    } else if (frameIndex % 64 == 32) {
+      factory.setLosingModalShowing(false);
+      steerAlongSerpentine(page, getBoardSize(), 1u);
+    }
+  });
+  output << ",\n";
+  runScenario(output, "scoreTicking", 1u, [](GamePageFactory<gamePageViewCount>& factory, View*const, const int frameIndex) {
+    if (frameIndex >= 0 && frameIndex % 8 == 0) factory.feed();
+  });
+  output << "\n  }\n}\n";
+}
+
+RenderBenchmark::~RenderBenchmark() {
+  delete overlayAtlas;
+  delete bodyAtlas;
+  delete headAtlas;
+  SDL_DestroyRenderer(renderer);
+  SDL_FreeSurface(surface);
+}
+
+}  // namespace ii887522::snake
+
+#endif
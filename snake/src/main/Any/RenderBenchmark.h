@@ -0,0 +1,83 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_RENDERBENCHMARK_H_
+#define SNAKE_SRC_MAIN_ANY_RENDERBENCHMARK_H_
+
+#ifndef TEST
+
+#include <Any/Reactive.h>
+#include <Any/View.h>
+#include <Struct/Size.h>
+#include <SDL.h>
+#include <ostream>
+#include <functional>
+#include "Enums.h"
+#include "GlyphAtlas.h"
+#include "../Factory/GamePageFactory.h"
+#include "../Factory/SnakeViewGroupFactory.h"
+
+using std::ostream;
+using std::function;
+using ii887522::nitro::Reactive;
+using ii887522::viewify::View;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+// It times full frames of the real game page in scripted scenarios, so that a change which makes the page slower to draw, such as
+// a view making a draw call per segment, shows up in numbers before it reaches players. The page is drawn by a software renderer
+// into a surface which is never shown, so it runs without a window or a GPU. Each scenario builds a new page, steers the snake
+// along the serpentine of the board so that it never dies on its own and runs the same number of frames of the same duration, so
+// the numbers of 2 runs on the same machine can be compared.
+// See also ../Factory/GamePageFactory.h and ../Functions/serpentine.h for more details
+// Not Thread Safe: it must only be used in main thread
+class RenderBenchmark final {
+  // remove copy semantics
+  RenderBenchmark(const RenderBenchmark&) = delete;
+  RenderBenchmark& operator=(const RenderBenchmark&) = delete;
+
+  // remove move semantics
+  RenderBenchmark(RenderBenchmark&&) = delete;
+  RenderBenchmark& operator=(RenderBenchmark&&) = delete;
+
+  static constexpr auto WARM_UP_FRAME_COUNT{ 30 };  // they build the modals and fill the back buffer of the board
+  static constexpr auto FRAME_COUNT{ 600 };
+  static constexpr auto FRAME_DURATION{ 16u };  // in milliseconds
+  static constexpr auto CELL_SIZE{ 16 };
+  static constexpr auto HEADER_HEIGHT{ 64 };  // the same as in the game page
+
+  const Size<int> size;
+  const RenderBackend renderBackend;
+  SDL_Surface*const surface;
+  SDL_Renderer*const renderer;
+  GlyphAtlas*const headAtlas;
+  GlyphAtlas*const bodyAtlas;
+  GlyphAtlas*const overlayAtlas;
+  Reactive<Path> currentPath;
+
+  // Return: the number of cells on each side of the board of the game page including the walls
+  Size<unsigned int> getBoardSize() const;
+
+  // Return: the number of cells inside the walls of the board of the game page
+  unsigned int getBackgroundCellCount() const;
+
+  // Param snakeLength: the number of segments the snake is laid with, it must be at least 1
+  // Param script: it is called before every frame with the frame index, which is negative while warming up
+  void runScenario(ostream&, const char*const name, const unsigned int snakeLength,
+    const function<void(GamePageFactory<gamePageViewCount>& factory, View*const page, const int frameIndex)>& script);
+
+ public:
+  // Param size: the size of the window the game page is drawn for
+  // Param renderBackend: how the board is drawn, see also ../View/BoardView.h for more details
+  explicit RenderBenchmark(const Size<int>& size, const RenderBackend renderBackend);
+
+  // Runs every scenario and writes the frame time distribution and the draw calls of each of them as a JSON object.
+  void run(ostream&);
+
+  ~RenderBenchmark();
+};
+
+}  // namespace ii887522::snake
+
+#endif
+#endif  // SNAKE_SRC_MAIN_ANY_RENDERBENCHMARK_H_
@@ -0,0 +1,94 @@
+// Copyright ii887522
+
+#include "ReplayReader.h"
+#include <string>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include <stdexcept>
+#include "Enums.h"
+#include "../Functions/stream_ext.h"
+#include "../Model/Simulation.h"
+#include "../Struct/Keyframe.h"
+#include "../Struct/ReplayHeader.h"
+#include "../Struct/ReplayEvent.h"
+#include "../Struct/KeyframeIndex.h"
+
+using std::string;
+using std::ios;
+using std::upper_bound;
+using std::lower_bound;
+using std::min;
+using std::runtime_error;
+using std::filesystem::directory_iterator;
+using std::filesystem::exists;
+
+namespace ii887522::snake {
+
+ReplayReader::ReplayReader(const string& filePath) : file{ filePath, ios::binary } {
+  if (!file) throw runtime_error{ "Failed to open replay file: " + filePath };
+  header = read<ReplayHeader>(file);
+  if (!file || header.magic != ReplayHeader::MAGIC) throw runtime_error{ "It is not a replay file: " + filePath };
+  if (header.version != ReplayHeader::VERSION) throw runtime_error{ "Unsupported replay file version: " + filePath };
+  if (header.keyframeCount == 0u) throw runtime_error{ "Replay file has no keyframe: " + filePath };
+  events.resize(header.eventCount);
+  file.seekg(header.eventsOffset);
+  file.read(reinterpret_cast<char*>(events.data()), events.size() * sizeof(ReplayEvent));
+  index.resize(header.keyframeCount);
+  file.seekg(header.indexOffset);
+  file.read(reinterpret_cast<char*>(index.data()), index.size() * sizeof(KeyframeIndex));
+  if (!file) throw runtime_error{ "Replay file is truncated: " + filePath };
+}
+
+string ReplayReader::getLatestFilePath(const string& dirPath) {
+  if (!exists(dirPath)) return "";
+  string result;
+  for (const auto& entry : directory_iterator{ dirPath }) {
+    // File names are timestamps of the same length, so the greatest name is the latest file
+    if (entry.is_regular_file() && entry.path().extension() == ".replay" && entry.path().string() > result)
+      result = entry.path().string();
+  }
+  return result;
+}
+
+Keyframe ReplayReader::readKeyframe(const unsigned long long offset) {
+  file.seekg(offset);
+  Keyframe result;
+  result.tick = read<unsigned int>(file);
+  result.score = read<unsigned int>(file);
+  result.direction = read<Direction>(file);
+  result.isDead = read<bool>(file);
+  result.hasFood = read<bool>(file);
+  result.food = read<Point<unsigned int>>(file);
+  result.body.resize(read<unsigned int>(file));
+  file.read(reinterpret_cast<char*>(result.body.data()), result.body.size() * sizeof result.body.front());
+  return result;
+}
+
+void ReplayReader::seek(const unsigned int tick, Simulation*const simulation) {
+  const auto clampedTick{ min(tick, getTickCount()) };
+  const auto keyframeIndex{
+    upper_bound(index.begin(), index.end(), clampedTick, [](const unsigned int l_tick, const KeyframeIndex& entry) {
+      return l_tick < entry.tick;
+    }) - 1
+  };
+  simulation->restore(readKeyframe(keyframeIndex->offset));
+  // A dead snake never ticks again, so a truncated or corrupt replay stops at the tick it died in
+  while (simulation->getTick() < clampedTick && !simulation->isOver()) stepForward(simulation);
+}
+
+void ReplayReader::stepForward(Simulation*const simulation) const {
+  const auto nextTick{ simulation->getTick() + 1u };
+  auto event{ lower_bound(events.begin(), events.end(), nextTick, [](const ReplayEvent& l_event, const unsigned int l_tick) {
+    return l_event.tick < l_tick;
+  }) };
+  auto direction{ simulation->getDirection() };
+  for (; event != events.end() && event->tick == nextTick && event->type == ReplayEventType::DIRECTION; ++event)
+    direction = event->direction;
+  simulation->step(direction);
+  for (; event != events.end() && event->tick == nextTick; ++event) {
+    if (event->type == ReplayEventType::FOOD) simulation->setFood(event->position);
+  }
+}
+
+}  // namespace ii887522::snake
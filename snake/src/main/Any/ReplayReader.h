@@ -0,0 +1,73 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_REPLAYREADER_H_
+#define SNAKE_SRC_MAIN_ANY_REPLAYREADER_H_
+
+#include <Struct/Size.h>
+#include <string>
+#include <vector>
+#include <fstream>
+#include "../Model/Simulation.h"
+#include "../Struct/Keyframe.h"
+#include "../Struct/ReplayHeader.h"
+#include "../Struct/ReplayEvent.h"
+#include "../Struct/KeyframeIndex.h"
+
+using std::string;
+using std::vector;
+using std::ifstream;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+// It reads a replay file written by ReplayWriter. Events and the keyframe index are loaded up front whereas keyframes are read
+// from the file on demand, so seeking to any tick costs O(log keyframeCount + keyframeInterval).
+// See also ../Struct/ReplayHeader.h for more details
+// Not Thread Safe
+class ReplayReader final {
+  // remove copy semantics
+  ReplayReader(const ReplayReader&) = delete;
+  ReplayReader& operator=(const ReplayReader&) = delete;
+
+  // remove move semantics
+  ReplayReader(ReplayReader&&) = delete;
+  ReplayReader& operator=(ReplayReader&&) = delete;
+
+  ifstream file;
+  ReplayHeader header;
+  vector<ReplayEvent> events;
+  vector<KeyframeIndex> index;
+
+  Keyframe readKeyframe(const unsigned long long offset);
+
+ public:
+  explicit ReplayReader(const string& filePath);
+
+  // Return: the path of the replay file most recently written into the directory given, or an empty string if there is none
+  static string getLatestFilePath(const string& dirPath);
+
+  constexpr const Size<unsigned int>& getBoardSize() const {
+    return header.boardSize;
+  }
+
+  constexpr unsigned int getTickCount() const {
+    return header.tickCount;
+  }
+
+  constexpr unsigned int getKeyframeInterval() const {
+    return header.keyframeInterval;
+  }
+
+  // Restores the simulation given to the state at the end of the tick given.
+  // Param simulation: its size must be equal to getBoardSize()
+  // Param tick: it is clamped to getTickCount(). The simulation stops at the tick the snake died in if it is earlier.
+  void seek(const unsigned int tick, Simulation*const simulation);
+
+  // Advances the simulation given by 1 tick. It is cheaper than seek() when playing a replay forward.
+  // Param simulation: it must have been restored by seek() before
+  void stepForward(Simulation*const simulation) const;
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_REPLAYREADER_H_
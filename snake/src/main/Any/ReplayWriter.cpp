@@ -0,0 +1,90 @@
+// Copyright ii887522
+
+#include "ReplayWriter.h"
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <string>
+#include <fstream>
+#include <filesystem>
+#include "Enums.h"
+#include "../Functions/stream_ext.h"
+#include "../Functions/time_ext.h"
+#include "../Struct/ReplayHeader.h"
+#include "../Struct/ReplayEvent.h"
+#include "../Struct/KeyframeIndex.h"
+
+using std::string;
+using std::ios;
+using std::filesystem::create_directories;
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+ReplayWriter::ReplayWriter(const string& dirPath, const Size<unsigned int>& boardSize, const unsigned int keyframeInterval) :
+  dirPath{ dirPath }, keyframeInterval{ keyframeInterval }, simulation{ boardSize }, isRecording{ false }, hasFood{ false },
+  food{ 0u, 0u } { }
+
+void ReplayWriter::writeKeyframe() {
+  const auto keyframe{ simulation.makeKeyframe() };
+  index.push_back(KeyframeIndex{ keyframe.tick, static_cast<unsigned long long>(file.tellp()) });
+  write(file, keyframe.tick);
+  write(file, keyframe.score);
+  write(file, keyframe.direction);
+  write(file, keyframe.isDead);
+  write(file, keyframe.hasFood);
+  write(file, keyframe.food);
+  write(file, static_cast<unsigned int>(keyframe.body.size()));
+  file.write(reinterpret_cast<const char*>(keyframe.body.data()), keyframe.body.size() * sizeof keyframe.body.front());
+}
+
+void ReplayWriter::begin() {
+  end();
+  if (dirPath.empty()) return;
+  create_directories(dirPath);
+  file.open(dirPath + getTimestamp() + ".replay", ios::binary | ios::trunc);
+  if (!file) return;
+  write(file, ReplayHeader{ });  // it is filled in by end()
+  events.clear();
+  index.clear();
+  simulation.reborn(Direction::UP);
+  if (hasFood) simulation.setFood(food);
+  isRecording = true;
+}
+
+void ReplayWriter::recordMove(const Direction direction) {
+  if (!isRecording) return;
+  if (simulation.getTick() % keyframeInterval == 0u && (index.empty() || index.back().tick != simulation.getTick())) writeKeyframe();
+  if (simulation.getTick() == 0u || direction != simulation.getDirection())
+    events.push_back(ReplayEvent{ simulation.getTick() + 1u, ReplayEventType::DIRECTION, direction, Point{ 0u, 0u } });
+  simulation.step(direction);
+}
+
+void ReplayWriter::recordFood(const Point<unsigned int>& position) {
+  hasFood = true;
+  food = position;
+  if (!isRecording) return;
+  events.push_back(ReplayEvent{ simulation.getTick(), ReplayEventType::FOOD, simulation.getDirection(), position });
+  simulation.setFood(position);
+}
+
+void ReplayWriter::end() {
+  if (!isRecording) return;
+  isRecording = false;
+  const auto eventsOffset{ static_cast<unsigned long long>(file.tellp()) };
+  file.write(reinterpret_cast<const char*>(events.data()), events.size() * sizeof(ReplayEvent));
+  const auto indexOffset{ static_cast<unsigned long long>(file.tellp()) };
+  file.write(reinterpret_cast<const char*>(index.data()), index.size() * sizeof(KeyframeIndex));
+  file.seekp(0);
+  write(file, ReplayHeader{
+    ReplayHeader::MAGIC, ReplayHeader::VERSION, simulation.getSize(), keyframeInterval, simulation.getTick(),
+    static_cast<unsigned int>(events.size()), static_cast<unsigned int>(index.size()), eventsOffset, indexOffset
+  });
+  file.close();
+}
+
+ReplayWriter::~ReplayWriter() {
+  end();
+}
+
+}  // namespace ii887522::snake
@@ -0,0 +1,72 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_REPLAYWRITER_H_
+#define SNAKE_SRC_MAIN_ANY_REPLAYWRITER_H_
+
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <string>
+#include <vector>
+#include <fstream>
+#include "Enums.h"
+#include "../Model/Simulation.h"
+#include "../Struct/ReplayEvent.h"
+#include "../Struct/KeyframeIndex.h"
+
+using std::string;
+using std::vector;
+using std::ofstream;
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+// It records a game into a replay file which can be read by ReplayReader. A keyframe is written every keyframeInterval ticks
+// and the direction changes in between are stored as events, so that seeking to any tick only needs to re-simulate at most
+// keyframeInterval ticks.
+// See also ../Struct/ReplayHeader.h for more details
+// Not Thread Safe
+class ReplayWriter final {
+  // remove copy semantics
+  ReplayWriter(const ReplayWriter&) = delete;
+  ReplayWriter& operator=(const ReplayWriter&) = delete;
+
+  // remove move semantics
+  ReplayWriter(ReplayWriter&&) = delete;
+  ReplayWriter& operator=(ReplayWriter&&) = delete;
+
+  const string dirPath;
+  const unsigned int keyframeInterval;
+  Simulation simulation;
+  ofstream file;
+  vector<ReplayEvent> events;
+  vector<KeyframeIndex> index;
+  bool isRecording;
+  bool hasFood;
+  Point<unsigned int> food;  // the last food position seen, it is carried over into the next game
+
+  void writeKeyframe();
+
+ public:
+  // Param dirPath: it must end with a slash, or be empty to record nothing
+  explicit ReplayWriter(const string& dirPath, const Size<unsigned int>& boardSize, const unsigned int keyframeInterval = 256u);
+
+  // Starts recording a new game into a new file and stops recording the previous one if any. The initial direction of the
+  // snake is taken from the first recordMove().
+  void begin();
+
+  // Records that the snake has moved by 1 cell.
+  void recordMove(const Direction);
+
+  // Records that the food has been spawned at the position given.
+  void recordFood(const Point<unsigned int>& position);
+
+  // Finishes the file of the game being recorded. It is a no-op if no game is being recorded.
+  void end();
+
+  ~ReplayWriter();
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_REPLAYWRITER_H_
@@ -0,0 +1,129 @@
+// Copyright ii887522
+
+#ifndef TEST
+
+#include "SessionPlayer.h"
+#include <View/ViewGroup.h>
+#include <Struct/Size.h>
+#include <SDL.h>
+#include <string>
+#include <vector>
+#include <array>
+#include <fstream>
+#include <stdexcept>
+#include <chrono>  // NOLINT(build/c++11)
+#include "Enums.h"
+#include "Histogram.h"
+#include "StartupTimeline.h"
+#include "../Factory/SnakeViewGroupFactory.h"
+#include "../Functions/stream_ext.h"
+#include "../Struct/SessionHeader.h"
+#include "../Struct/SessionEvent.h"
+
+using std::string;
+using std::vector;
+using std::array;
+using std::ifstream;
+using std::ios;
+using std::runtime_error;
+using std::chrono::high_resolution_clock;
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+using ii887522::viewify::ViewGroup;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+SessionPlayer::SessionPlayer(const string& filePath, const Size<int>& size, const RenderBackend renderBackend) : size{ size },
+  renderBackend{ renderBackend }, surface{ SDL_CreateRGBSurfaceWithFormat(0u, size.w, size.h, 32, SDL_PIXELFORMAT_ARGB8888) },
+  renderer{ SDL_CreateSoftwareRenderer(surface) }, seed{ 0ull } {
+  ifstream file{ filePath, ios::binary };
+  if (!file) throw runtime_error{ "Failed to open session file: " + filePath };
+  const auto header{ read<SessionHeader>(file) };
+  if (!file || header.magic != SessionHeader::MAGIC) throw runtime_error{ "It is not a session file: " + filePath };
+  if (header.version != SessionHeader::VERSION) throw runtime_error{ "Unsupported session file version: " + filePath };
+  seed = header.seed;
+  // The last event may be cut short if the app was killed while recording, so only the whole ones are kept
+  for (auto event{ read<SessionEvent>(file) }; file; event = read<SessionEvent>(file)) events.push_back(event);
+}
+
+void SessionPlayer::play(array<Histogram, static_cast<unsigned int>(Phase::COUNT)>*const histograms) {
+  StartupTimeline startupTimeline{ "" };
+  SnakeViewGroupFactory<appViewCount> factory{
+    &startupTimeline, Size{ 0u, 0u }, 0u, "", renderBackend, seed, "", nullptr, true
+  };
+  auto viewGroup{ factory.make(renderer, size) };
+  // The fonts are loaded in the background, so they are waited for to make every play go the same way no matter how long they take
+  while (!factory.isLoaded()) {
+    viewGroup.step(0u);
+    viewGroup.checkAndReactHits(0u);
+    viewGroup.render();
+    SDL_Delay(1u);
+  }
+  auto prevTime{ 0u };
+  auto inputBegin{ high_resolution_clock::now() };
+  for (const auto& event : events) {
+    switch (event.type) {
+      case SDL_KEYDOWN:
+      case SDL_KEYUP: {
+        SDL_KeyboardEvent keyEvent{ };
+        keyEvent.type = event.type;
+        keyEvent.keysym.sym = event.code;
+        if (event.type == SDL_KEYDOWN) viewGroup.reactKeyDown(keyEvent);
+        else viewGroup.reactKeyUp(keyEvent);
+        break;
+      }
+      case SDL_MOUSEMOTION: {
+        SDL_MouseMotionEvent motionEvent{ };
+        motionEvent.type = event.type;
+        motionEvent.x = event.position.x;
+        motionEvent.y = event.position.y;
+        viewGroup.reactMouseMotion(motionEvent);
+        break;
+      }
+      case SDL_MOUSEBUTTONDOWN:
+      case SDL_MOUSEBUTTONUP: {
+        SDL_MouseButtonEvent buttonEvent{ };
+        buttonEvent.type = event.type;
+        buttonEvent.button = static_cast<Uint8>(event.code);
+        buttonEvent.state = event.type == SDL_MOUSEBUTTONDOWN ? SDL_PRESSED : SDL_RELEASED;
+        buttonEvent.clicks = 1u;
+        buttonEvent.x = event.position.x;
+        buttonEvent.y = event.position.y;
+        if (event.type == SDL_MOUSEBUTTONDOWN) viewGroup.reactMouseButtonDown(buttonEvent);
+        else viewGroup.reactMouseButtonUp(buttonEvent);
+        break;
+      }
+      case SessionEvent::FRAME: {
+        // The inputs received since the previous frame belong to this frame
+        const auto dt{ event.time - prevTime };
+        prevTime = event.time;
+        const auto stepBegin{ high_resolution_clock::now() };
+        viewGroup.step(dt);
+        const auto checkHitsBegin{ high_resolution_clock::now() };
+        viewGroup.checkAndReactHits(dt);
+        const auto renderBegin{ high_resolution_clock::now() };
+        SDL_SetRenderDrawColor(renderer, 0u, 0u, 0u, 255u);
+        SDL_RenderClear(renderer);
+        viewGroup.render();
+        SDL_RenderPresent(renderer);
+        const auto end{ high_resolution_clock::now() };
+        (*histograms)[static_cast<unsigned int>(Phase::INPUT)].add(duration_cast<microseconds>(stepBegin - inputBegin).count());
+        (*histograms)[static_cast<unsigned int>(Phase::STEP)].add(duration_cast<microseconds>(checkHitsBegin - stepBegin).count());
+        (*histograms)[static_cast<unsigned int>(Phase::CHECK_HITS)].add(
+          duration_cast<microseconds>(renderBegin - checkHitsBegin).count());
+        (*histograms)[static_cast<unsigned int>(Phase::RENDER)].add(duration_cast<microseconds>(end - renderBegin).count());
+        inputBegin = high_resolution_clock::now();
+      }
+    }
+  }
+}
+
+SessionPlayer::~SessionPlayer() {
+  SDL_DestroyRenderer(renderer);
+  SDL_FreeSurface(surface);
+}
+
+}  // namespace ii887522::snake
+
+#endif
@@ -0,0 +1,62 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_SESSIONPLAYER_H_
+#define SNAKE_SRC_MAIN_ANY_SESSIONPLAYER_H_
+
+#ifndef TEST
+
+#include <Struct/Size.h>
+#include <SDL.h>
+#include <string>
+#include <vector>
+#include <array>
+#include "Enums.h"
+#include "Histogram.h"
+#include "../Struct/SessionEvent.h"
+
+using std::string;
+using std::vector;
+using std::array;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+// It plays a session recorded by SessionRecorder again through the whole app, the same view group with the same pages, modals
+// and score as users get, and measures how long every phase of every frame takes. The app is drawn by a software renderer into a
+// surface which is never shown, so it runs without a window. Frames are stepped with the durations recorded instead of the real
+// time taken, and the games are played with the seed recorded, so every play of a session goes exactly the same way.
+// See also ../View/SessionRecorder.h for more details
+// Not Thread Safe: it must only be used in main thread
+class SessionPlayer final {
+  // remove copy semantics
+  SessionPlayer(const SessionPlayer&) = delete;
+  SessionPlayer& operator=(const SessionPlayer&) = delete;
+
+  // remove move semantics
+  SessionPlayer(SessionPlayer&&) = delete;
+  SessionPlayer& operator=(SessionPlayer&&) = delete;
+
+  const Size<int> size;
+  const RenderBackend renderBackend;
+  SDL_Surface*const surface;
+  SDL_Renderer*const renderer;
+  unsigned long long seed;
+  vector<SessionEvent> events;
+
+ public:
+  // Param filePath: the session file to play, it must have been recorded by SessionRecorder
+  // Param size: the size of the window the session was recorded with
+  // Param renderBackend: how the boards are drawn, see also ../View/BoardView.h for more details
+  explicit SessionPlayer(const string& filePath, const Size<int>& size, const RenderBackend renderBackend);
+
+  // Plays the whole session once in a new view group.
+  // Param histograms: the time spent in each phase of every frame is added into the histogram of that phase
+  void play(array<Histogram, static_cast<unsigned int>(Phase::COUNT)>*const histograms);
+
+  ~SessionPlayer();
+};
+
+}  // namespace ii887522::snake
+
+#endif
+#endif  // SNAKE_SRC_MAIN_ANY_SESSIONPLAYER_H_
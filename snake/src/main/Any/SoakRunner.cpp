@@ -0,0 +1,192 @@
+// Copyright ii887522
+
+#ifndef TEST
+
+#include "SoakRunner.h"
+#include <Any/Reactive.h>
+#include <Any/View.h>
+#include <ViewGroup/Page.h>
+#include <Struct/Size.h>
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <ostream>
+#include <string>
+#include <atomic>
+#include <algorithm>
+#include <utility>
+#include <filesystem>
+#include <system_error>
+#include <chrono>  // NOLINT(build/c++11)
+#include "Enums.h"
+#include "GlyphAtlas.h"
+#include "Histogram.h"
+#include "GrowthTracker.h"
+#include "../Factory/GamePageFactory.h"
+#include "../Factory/SnakeViewGroupFactory.h"
+#include "../Functions/random_ext.h"
+#include "../Functions/process_ext.h"
+#include "../Functions/accounting.h"
+#include "../Functions/steer.h"
+
+using std::ostream;
+using std::string;
+using std::atomic;
+using std::max;
+using std::pair;
+using std::error_code;
+using std::filesystem::remove_all;
+using std::chrono::high_resolution_clock;
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+using ii887522::nitro::Reactive;
+using ii887522::viewify::View;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+SoakRunner::SoakRunner(const Size<int>& size, const RenderBackend renderBackend, const SoakInput input,
+  const unsigned long long gameCount, const unsigned long long seed) : size{ size }, input{ input }, gameCount{ gameCount },
+  seed{ seed }, surface{ SDL_CreateRGBSurfaceWithFormat(0u, size.w, size.h, 32, SDL_PIXELFORMAT_ARGB8888) },
+  renderer{ SDL_CreateSoftwareRenderer(surface) }, headAtlas{ new GlyphAtlas{ renderer, 64 } },
+  bodyAtlas{ new GlyphAtlas{ renderer, 32 } },
+  overlayAtlas{ new GlyphAtlas{ renderer, 14 } }, currentPath{ Path::GAME }, factory{ nullptr }, page{ nullptr },
+  randomState{ seed }, isStopped{ false }, frameCount{ 0ull }, prevAllocationCount{ 0ull },
+  growthTracker{ WARM_UP_SAMPLE_COUNT } {
+  for (const auto& [atlas, ptSize] : { pair{ headAtlas, 64 }, pair{ bodyAtlas, 32 }, pair{ overlayAtlas, 14 } }) {
+    // The atlas is left drawing placeholders if the font cannot be opened
+    const auto font{ TTF_OpenFont("res/main/arial.ttf", ptSize) };
+    if (!font) continue;
+    atlas->bake(font);
+    TTF_CloseFont(font);
+    atlas->upload();
+  }
+  factory = GamePageFactory<gamePageViewCount>::Builder{ renderer, size, nullptr, &currentPath }
+    .setHeadAtlas(headAtlas)
+    .setBodyAtlas(bodyAtlas)
+    .setOverlayAtlas(overlayAtlas)
+    .setButtonDuration(125u)
+    .setButtonPadding(Size{ 20, 12 })
+    .setCellSize(CELL_SIZE)
+    .setReplayDirPath(REPLAY_DIR_PATH)
+    .setStatsDirPath("soak/stats/")
+    .setRenderBackend(renderBackend)
+    .setSnakeLength(input == SoakInput::AUTOPILOT ? 1u : 0u)
+    .setSeed(seed)
+    .build();
+  page = factory->make();
+}
+
+Size<unsigned int> SoakRunner::getBoardSize() const {
+  // The board fits the area below the header band, the same as in the game
+  return Size{ static_cast<unsigned int>(size.w / CELL_SIZE), static_cast<unsigned int>((size.h - HEADER_HEIGHT) / CELL_SIZE) };
+}
+
+void SoakRunner::pressRandomKey() {
+  constexpr SDL_Keycode keyCodes[]{ SDLK_w, SDLK_d, SDLK_s, SDLK_a };
+  const auto keyIndex{ nextRandom(&randomState, KEY_CHANCE << 2u) };
+  if (keyIndex >= 4u) return;
+  SDL_KeyboardEvent keyEvent{ };
+  keyEvent.type = SDL_KEYDOWN;
+  keyEvent.keysym.sym = keyCodes[keyIndex];
+  page->reactKeyDown(keyEvent);
+}
+
+void SoakRunner::clickPlayAgain() {
+  const auto center{ factory->getPlayAgainButtonCenter() };
+  SDL_MouseMotionEvent motionEvent{ };
+  motionEvent.type = SDL_MOUSEMOTION;
+  motionEvent.x = center.x;
+  motionEvent.y = center.y;
+  page->reactMouseMotion(motionEvent);
+  SDL_MouseButtonEvent buttonEvent{ };
+  buttonEvent.type = SDL_MOUSEBUTTONDOWN;
+  buttonEvent.button = SDL_BUTTON_LEFT;
+  buttonEvent.state = SDL_PRESSED;
+  buttonEvent.clicks = 1u;
+  buttonEvent.x = center.x;
+  buttonEvent.y = center.y;
+  page->reactMouseButtonDown(buttonEvent);
+  buttonEvent.type = SDL_MOUSEBUTTONUP;
+  buttonEvent.state = SDL_RELEASED;
+  page->reactMouseButtonUp(buttonEvent);
+}
+
+void SoakRunner::sample(ostream& output, const unsigned long long playedGameCount) {
+  const auto residentSetSize{ getResidentSetSize() };
+  const auto privateBytes{ getPrivateBytes() };
+  const auto allocationCount{ getAllocationCount() };
+  const auto sdlAllocationCount{ SDL_GetNumAllocations() };
+  output << playedGameCount << '\t' << frameCount << '\t' << residentSetSize << '\t' << privateBytes << '\t';
+  growthTracker.add("residentSetSize", static_cast<double>(residentSetSize));
+  growthTracker.add("privateBytes", static_cast<double>(privateBytes));
+  output << getLiveAllocationCount() << '\t' << allocationCount - prevAllocationCount << '\t';
+  growthTracker.add("liveAllocations", static_cast<double>(getLiveAllocationCount()));
+  growthTracker.add("allocations", static_cast<double>(allocationCount - prevAllocationCount));
+  output << sdlAllocationCount << '\t' << frameHistogram.getPercentile(50.) << '\t' << frameHistogram.getPercentile(99.) << '\t' <<
+    frameHistogram.getMax();
+  for (auto i{ 0u }; i != static_cast<unsigned int>(MemoryCategory::COUNT); ++i) {
+    const auto categoryBytes{ getMemoryUsage(static_cast<MemoryCategory>(i)).bytes };
+    output << '\t' << categoryBytes;
+    growthTracker.add(string{ memoryCategoryNames[i] } + "Bytes", static_cast<double>(categoryBytes));
+  }
+  output << '\n';
+  output.flush();
+  growthTracker.add("sdlAllocations", static_cast<double>(sdlAllocationCount));
+  growthTracker.add("frameP50Us", static_cast<double>(frameHistogram.getPercentile(50.)));
+  growthTracker.add("frameP99Us", static_cast<double>(frameHistogram.getPercentile(99.)));
+  frameHistogram.reset();
+  prevAllocationCount = allocationCount;
+  // No replay is being recorded between games, and a unit which runs for weeks must not run out of disk space either
+  error_code errorCode;
+  remove_all(REPLAY_DIR_PATH, errorCode);
+}
+
+unsigned int SoakRunner::run(ostream& output) {
+  const auto sampleGameCount{ max(gameCount / SAMPLE_COUNT, 1ull) };
+  output << "# seed " << seed << ", " << (input == SoakInput::AUTOPILOT ? "autopilot" : "random") << " input, " << gameCount <<
+    " games, sampled every " << sampleGameCount << " games\n" <<
+    "games\tframes\tresidentSetSize\tprivateBytes\tliveAllocations\tallocations\tsdlAllocations\tframeP50Us\tframeP99Us\t"
+    "frameMaxUs";
+  for (const auto memoryCategoryName : memoryCategoryNames) output << '\t' << memoryCategoryName << "Bytes";
+  output << '\n';
+  prevAllocationCount = getAllocationCount();
+  if (input == SoakInput::AUTOPILOT) steerAlongSerpentine(page, getBoardSize(), 1u);
+  auto overFrameCount{ 0u };
+  for (auto playedGameCount{ 0ull }; playedGameCount != gameCount && !isStopped; ) {
+    if (input == SoakInput::RANDOM && !factory->isOver()) pressRandomKey();
+    const auto begin{ high_resolution_clock::now() };
+    page->step(FRAME_DURATION);
+    page->checkAndReactHits(FRAME_DURATION);
+    SDL_SetRenderDrawColor(renderer, 0u, 0u, 0u, 255u);
+    SDL_RenderClear(renderer);
+    page->render();
+    SDL_RenderPresent(renderer);
+    frameHistogram.add(duration_cast<microseconds>(high_resolution_clock::now() - begin).count());
+    ++frameCount;
+    if (!factory->isOver() || ++overFrameCount != OVER_FRAME_COUNT) continue;
+    overFrameCount = 0u;
+    if (++playedGameCount % sampleGameCount == 0ull) sample(output, playedGameCount);
+    clickPlayAgain();
+    if (input == SoakInput::AUTOPILOT) steerAlongSerpentine(page, getBoardSize(), 1u);
+  }
+  output << '\n';
+  return growthTracker.report(output);
+}
+
+void SoakRunner::stop() {
+  isStopped = true;
+}
+
+SoakRunner::~SoakRunner() {
+  delete page;
+  delete factory;
+  delete overlayAtlas;
+  delete bodyAtlas;
+  delete headAtlas;
+  SDL_DestroyRenderer(renderer);
+  SDL_FreeSurface(surface);
+}
+
+}  // namespace ii887522::snake
+
+#endif
@@ -0,0 +1,108 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_SOAKRUNNER_H_
+#define SNAKE_SRC_MAIN_ANY_SOAKRUNNER_H_
+
+#ifndef TEST
+
+#include <Any/Reactive.h>
+#include <Any/View.h>
+#include <Struct/Size.h>
+#include <SDL.h>
+#include <ostream>
+#include <atomic>
+#include "Enums.h"
+#include "GlyphAtlas.h"
+#include "Histogram.h"
+#include "GrowthTracker.h"
+#include "../Factory/GamePageFactory.h"
+#include "../Factory/SnakeViewGroupFactory.h"
+
+using std::ostream;
+using std::atomic;
+using ii887522::nitro::Reactive;
+using ii887522::viewify::View;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+// It plays games on the real game page back to back for as long as a unit runs without restarting, going through the death of
+// the snake, the modal shown and the "Play again" button every time, so that memory which leaks or fragments a little on every
+// game shows up before it reaches players. The page is drawn by a software renderer into a surface which is never shown, so it
+// runs without a window or a GPU. The memory of the process, the allocations, the SDL objects alive such as textures and the
+// frame times are sampled every few games, and every metric which keeps going up after warming up is reported.
+// See also GrowthTracker.h and ../Factory/GamePageFactory.h for more details
+// Not Thread Safe: it must only be used in main thread, except stop()
+class SoakRunner final {
+  // remove copy semantics
+  SoakRunner(const SoakRunner&) = delete;
+  SoakRunner& operator=(const SoakRunner&) = delete;
+
+  // remove move semantics
+  SoakRunner(SoakRunner&&) = delete;
+  SoakRunner& operator=(SoakRunner&&) = delete;
+
+  static constexpr auto SAMPLE_COUNT{ 100ull };  // over a run which is not stopped early
+  static constexpr auto WARM_UP_SAMPLE_COUNT{ 10u };
+  static constexpr auto FRAME_DURATION{ 16u };  // in milliseconds
+  static constexpr auto OVER_FRAME_COUNT{ 16u };  // the modal has faded in by then and "Play again" is clicked
+  static constexpr auto KEY_CHANCE{ 16u };  // a random key is pressed once every that many frames on average
+  static constexpr auto CELL_SIZE{ 16 };
+  static constexpr auto HEADER_HEIGHT{ 64 };  // the same as in the game page
+  static constexpr auto REPLAY_DIR_PATH{ "soak/replays/" };
+
+  const Size<int> size;
+  const SoakInput input;
+  const unsigned long long gameCount;
+  const unsigned long long seed;
+  SDL_Surface*const surface;
+  SDL_Renderer*const renderer;
+  GlyphAtlas*const headAtlas;
+  GlyphAtlas*const bodyAtlas;
+  GlyphAtlas*const overlayAtlas;
+  Reactive<Path> currentPath;
+  GamePageFactory<gamePageViewCount>* factory;
+  View* page;
+  unsigned long long randomState;
+  atomic<bool> isStopped;
+  Histogram frameHistogram;  // the frames since the last sample
+  unsigned long long frameCount;
+  unsigned long long prevAllocationCount;  // the allocation count at the last sample
+  GrowthTracker growthTracker;
+
+  // Return: the number of cells on each side of the board of the game page including the walls
+  Size<unsigned int> getBoardSize() const;
+
+  void pressRandomKey();
+
+  // It moves the mouse onto the "Play again" button of the modal showing, then presses and releases it, the same as a player.
+  void clickPlayAgain();
+
+  // It writes the metrics as 1 line of the table and removes the replays recorded since the last sample.
+  void sample(ostream&, const unsigned long long playedGameCount);
+
+ public:
+  // Param size: the size of the window the game page is drawn for
+  // Param renderBackend: how the board is drawn, see also ../View/BoardView.h for more details
+  // Param input: with SoakInput::RANDOM, a snake born in the middle is turned at random and the games are recorded as replays
+  //   like the ones played. With SoakInput::AUTOPILOT, a snake is laid with 1 segment and steered along the serpentine of the
+  //   board, so it eats every food on its way and grows long before it hits the wall at the end.
+  // Param gameCount: the number of games played unless stop() is called before
+  // Param seed: the same seed always plays the same games
+  explicit SoakRunner(const Size<int>& size, const RenderBackend renderBackend, const SoakInput input,
+    const unsigned long long gameCount, const unsigned long long seed);
+
+  // Plays every game and writes a table of the metrics sampled followed by the metrics which keep going up, 1 metric per line.
+  // Return: the number of metrics which keep going up
+  unsigned int run(ostream&);
+
+  // Thread Safe: it can be called from any thread, the game being played is the last one
+  void stop();
+
+  ~SoakRunner();
+};
+
+}  // namespace ii887522::snake
+
+#endif
+#endif  // SNAKE_SRC_MAIN_ANY_SOAKRUNNER_H_
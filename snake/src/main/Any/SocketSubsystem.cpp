@@ -0,0 +1,20 @@
+// Copyright ii887522
+
+#include "SocketSubsystem.h"
+#include <winsock2.h>
+#include <stdexcept>
+
+using std::runtime_error;
+
+namespace ii887522::snake {
+
+SocketSubsystem::SocketSubsystem() {
+  WSADATA data;
+  if (WSAStartup(MAKEWORD(2, 2), &data) != 0) throw runtime_error{ "Failed to initialize Windows Sockets!" };
+}
+
+SocketSubsystem::~SocketSubsystem() {
+  WSACleanup();
+}
+
+}  // namespace ii887522::snake
@@ -0,0 +1,26 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_SOCKETSUBSYSTEM_H_
+#define SNAKE_SRC_MAIN_ANY_SOCKETSUBSYSTEM_H_
+
+namespace ii887522::snake {
+
+// It initializes Windows Sockets while it is alive. Sockets must only be used while an instance is alive.
+// Not Thread Safe
+class SocketSubsystem final {
+  // remove copy semantics
+  SocketSubsystem(const SocketSubsystem&) = delete;
+  SocketSubsystem& operator=(const SocketSubsystem&) = delete;
+
+  // remove move semantics
+  SocketSubsystem(SocketSubsystem&&) = delete;
+  SocketSubsystem& operator=(SocketSubsystem&&) = delete;
+
+ public:
+  explicit SocketSubsystem();
+  ~SocketSubsystem();
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_SOCKETSUBSYSTEM_H_
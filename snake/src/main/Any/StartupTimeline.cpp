@@ -0,0 +1,48 @@
+// Copyright ii887522
+
+#include "StartupTimeline.h"
+#include <string>
+#include <fstream>
+#include <filesystem>
+#include <chrono>  // NOLINT(build/c++11)
+#include "../Functions/time_ext.h"
+#include "../Functions/trace.h"
+
+using std::string;
+using std::ofstream;
+using std::filesystem::create_directories;
+using std::chrono::high_resolution_clock;
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+
+namespace ii887522::snake {
+
+StartupTimeline::StartupTimeline(const string& dirPath) : dirPath{ dirPath }, startTime{ high_resolution_clock::now() },
+  hasFinished{ false } { }
+
+void StartupTimeline::mark(const char*const phaseName) {
+  const auto now{ high_resolution_clock::now() };
+  traceComplete(phaseName, "startup", marks.empty() ? startTime : marks.back().second, now);
+  marks.emplace_back(phaseName, now);
+}
+
+void StartupTimeline::finish() {
+  if (hasFinished) return;
+  mark("firstFrame");
+  hasFinished = true;
+  if (dirPath.empty()) return;
+  create_directories(dirPath);
+  ofstream file{ dirPath + "startup-" + getTimestamp() + ".json" };
+  file << "{\n  \"timeToFirstFrameUs\": " << duration_cast<microseconds>(marks.back().second - startTime).count() <<
+    ",\n  \"phases\": [";
+  auto prevTime{ startTime };
+  for (auto i{ 0u }; i != marks.size(); ++i) {
+    file << (i == 0u ? "\n" : ",\n") << "    { \"name\": \"" << marks[i].first << "\", \"startUs\": " <<
+      duration_cast<microseconds>(prevTime - startTime).count() << ", \"durationUs\": " <<
+      duration_cast<microseconds>(marks[i].second - prevTime).count() << " }";
+    prevTime = marks[i].second;
+  }
+  file << "\n  ]\n}\n";
+}
+
+}  // namespace ii887522::snake
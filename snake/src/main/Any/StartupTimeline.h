@@ -0,0 +1,52 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_STARTUPTIMELINE_H_
+#define SNAKE_SRC_MAIN_ANY_STARTUPTIMELINE_H_
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <chrono>  // NOLINT(build/c++11)
+
+using std::string;
+using std::vector;
+using std::pair;
+using std::chrono::high_resolution_clock;
+
+namespace ii887522::snake {
+
+// It measures how long each startup phase takes until the first frame is rendered. Every mark ends the phase started by the
+// previous mark, or by the timeline creation for the first mark. Phases are also recorded as trace events when tracing.
+// Not Thread Safe: it must only be used in main thread
+class StartupTimeline final {
+  // remove copy semantics
+  StartupTimeline(const StartupTimeline&) = delete;
+  StartupTimeline& operator=(const StartupTimeline&) = delete;
+
+  // remove move semantics
+  StartupTimeline(StartupTimeline&&) = delete;
+  StartupTimeline& operator=(StartupTimeline&&) = delete;
+
+  const string dirPath;
+  const high_resolution_clock::time_point startTime;
+  vector<pair<const char*, high_resolution_clock::time_point>> marks;  // the name and end time of each phase
+  bool hasFinished;
+
+ public:
+  // Param dirPath: it must end with a slash, or be empty to write nothing
+  explicit StartupTimeline(const string& dirPath);
+
+  constexpr bool isFinished() const {
+    return hasFinished;
+  }
+
+  // Param phaseName: it must point to a string literal
+  void mark(const char*const phaseName);
+
+  // Marks the first frame rendered and writes the timeline into a new JSON file in dirPath. It is a no-op after the first call.
+  void finish();
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_STARTUPTIMELINE_H_
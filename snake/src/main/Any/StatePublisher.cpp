@@ -0,0 +1,132 @@
+// Copyright ii887522
+
+#include "StatePublisher.h"
+#include <windows.h>
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <cstring>
+#include <algorithm>
+#include "Enums.h"
+#include "../Struct/SharedStateHeader.h"
+#include "../Struct/SharedStateSlot.h"
+#include "../Struct/SharedState.h"
+
+using std::string;
+using std::vector;
+using std::atomic_thread_fence;
+using std::memory_order_relaxed;
+using std::memory_order_release;
+using std::memcpy;
+using std::fill;
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+// Return: the size of a slot including the packed cells, rounded up so that every slot stays aligned
+static constexpr unsigned int getSlotSize(const Size<unsigned int>& boardSize) {
+  const auto size{ static_cast<unsigned int>(sizeof(SharedStateSlot)) + ((boardSize.w * boardSize.h + 1u) >> 1u) };
+  return (size + alignof(SharedStateSlot) - 1u) / alignof(SharedStateSlot) * alignof(SharedStateSlot);
+}
+
+StatePublisher::StatePublisher(const string& name, const Size<unsigned int>& boardSize) : simulation{ boardSize },
+  cells((static_cast<unsigned long long>(boardSize.w) * boardSize.h + 1u) >> 1u), mapping{ nullptr }, header{ nullptr },
+  isPlaying{ false }, hasFood{ false }, food{ 0u, 0u } {
+  const auto size{ sizeof(SharedStateHeader) + static_cast<unsigned long long>(getSlotSize(boardSize)) * SLOT_COUNT };
+  mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, static_cast<DWORD>(size >> 32u), static_cast<DWORD>(size),
+    name.c_str());
+  if (!mapping) return;
+  // Another game is publishing under the same name, so it is left alone
+  if (GetLastError() == ERROR_ALREADY_EXISTS) {
+    CloseHandle(mapping);
+    mapping = nullptr;
+    return;
+  }
+  header = static_cast<SharedStateHeader*>(MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0u, 0u, size));
+  if (!header) return;
+  // The memory is zero filled, so every slot sequence starts even and nothing has been published yet
+  header->magic = SharedStateHeader::MAGIC;
+  header->version = SharedStateHeader::VERSION;
+  header->boardSize = boardSize;
+  header->slotCount = SLOT_COUNT;
+  header->slotSize = getSlotSize(boardSize);
+}
+
+void StatePublisher::updateCell(const Point<unsigned int>& position) {
+  const auto index{ static_cast<unsigned long long>(position.y) * simulation.getSize().w + position.x };
+  const auto shift{ (index & 1u) << 2u };
+  auto& cell{ cells[index >> 1u] };
+  cell = static_cast<unsigned char>((cell & ~(0xfu << shift)) | static_cast<unsigned int>(simulation.get(position)) << shift);
+}
+
+SharedStateSlot* StatePublisher::getSlot(const unsigned long long index) {
+  return reinterpret_cast<SharedStateSlot*>(reinterpret_cast<char*>(header + 1u) + index % SLOT_COUNT * header->slotSize);
+}
+
+void StatePublisher::publish() {
+  if (!header) return;
+  const auto publishCount{ header->publishCount.load(memory_order_relaxed) };
+  const auto slot{ getSlot(publishCount) };
+  const auto sequence{ slot->sequence.load(memory_order_relaxed) };
+  slot->sequence.store(sequence + 1u, memory_order_relaxed);
+  atomic_thread_fence(memory_order_release);
+  slot->state = SharedState{
+    simulation.getTick(), simulation.getScore(), static_cast<unsigned int>(simulation.getBody().size()), simulation.getBody().front(),
+    simulation.getBody().back(), simulation.getFood(), simulation.isFoodSpawned(), simulation.isOver()
+  };
+  memcpy(reinterpret_cast<unsigned char*>(slot + 1u), cells.data(), cells.size());
+  slot->sequence.store(sequence + 2u, memory_order_release);
+  header->publishCount.store(publishCount + 1u, memory_order_release);
+}
+
+void StatePublisher::begin() {
+  if (!header) return;
+  simulation.reborn(Direction::UP);
+  if (hasFood) simulation.setFood(food);
+  fill(cells.begin(), cells.end(), static_cast<unsigned char>(0u));
+  const auto& size{ simulation.getSize() };
+  for (auto x{ 0u }; x != size.w; ++x) {
+    updateCell(Point{ x, 0u });
+    updateCell(Point{ x, size.h - 1u });
+  }
+  for (auto y{ 1u }; y != size.h - 1u; ++y) {
+    updateCell(Point{ 0u, y });
+    updateCell(Point{ size.w - 1u, y });
+  }
+  updateCell(simulation.getBody().front());
+  if (hasFood) updateCell(food);
+  isPlaying = true;
+  publish();
+}
+
+void StatePublisher::recordMove(const Direction direction) {
+  if (!header || !isPlaying) return;
+  const auto head{ simulation.getBody().front() };
+  const auto tail{ simulation.getBody().back() };
+  simulation.step(direction);
+  updateCell(head);
+  updateCell(tail);
+  updateCell(simulation.getBody().front());
+  if (simulation.isOver()) isPlaying = false;
+  publish();
+}
+
+void StatePublisher::recordFood(const Point<unsigned int>& position) {
+  hasFood = true;
+  const auto previousFood{ food };
+  food = position;
+  if (!header || !isPlaying) return;
+  simulation.setFood(position);
+  updateCell(previousFood);
+  updateCell(position);
+}
+
+StatePublisher::~StatePublisher() {
+  if (header) UnmapViewOfFile(header);
+  if (mapping) CloseHandle(mapping);
+}
+
+}  // namespace ii887522::snake
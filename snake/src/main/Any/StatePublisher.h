@@ -0,0 +1,72 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_STATEPUBLISHER_H_
+#define SNAKE_SRC_MAIN_ANY_STATEPUBLISHER_H_
+
+#include <windows.h>
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <string>
+#include <vector>
+#include "Enums.h"
+#include "../Model/Simulation.h"
+#include "../Struct/SharedStateHeader.h"
+#include "../Struct/SharedStateSlot.h"
+
+using std::string;
+using std::vector;
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+// It publishes the state of the game being played into named shared memory at the end of every tick, so that other processes on
+// this machine can observe the game without slowing it down. The latest few ticks are kept in a ring of slots, each guarded by a
+// sequence lock, so the game never waits for a reader and a reader only retries if the game has lapped the whole ring while it
+// was copying.
+// See also ../Struct/SharedStateHeader.h and StateReader.h for more details
+// Not Thread Safe
+class StatePublisher final {
+  // remove copy semantics
+  StatePublisher(const StatePublisher&) = delete;
+  StatePublisher& operator=(const StatePublisher&) = delete;
+
+  // remove move semantics
+  StatePublisher(StatePublisher&&) = delete;
+  StatePublisher& operator=(StatePublisher&&) = delete;
+
+  static constexpr auto SLOT_COUNT{ 4u };
+
+  Simulation simulation;
+  vector<unsigned char> cells;  // the cells of the simulation packed in the same way as in the shared memory
+  HANDLE mapping;
+  SharedStateHeader* header;  // it is nullptr if the shared memory can not be created, then nothing is published
+  bool isPlaying;
+  bool hasFood;
+  Point<unsigned int> food;  // the last food position seen, it is carried over into the next game
+
+  // Copies the cell at the position given from the simulation into cells.
+  void updateCell(const Point<unsigned int>& position);
+
+  SharedStateSlot* getSlot(const unsigned long long index);
+  void publish();
+
+ public:
+  // Param name: the name of the shared memory, no other process may have created shared memory with the same name
+  explicit StatePublisher(const string& name, const Size<unsigned int>& boardSize);
+
+  // Starts publishing a new game. The initial direction of the snake is taken from the first recordMove().
+  void begin();
+
+  // Records that the snake has moved by 1 cell and publishes the tick.
+  void recordMove(const Direction);
+
+  // Records that the food has been spawned at the position given.
+  void recordFood(const Point<unsigned int>& position);
+
+  ~StatePublisher();
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_STATEPUBLISHER_H_
@@ -0,0 +1,70 @@
+// Copyright ii887522
+
+#include "StateReader.h"
+#include <windows.h>
+#include <Struct/Point.h>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <stdexcept>
+#include <cstring>
+#include "Enums.h"
+#include "../Struct/SharedStateHeader.h"
+#include "../Struct/SharedStateSlot.h"
+#include "../Struct/SharedState.h"
+
+using std::string;
+using std::vector;
+using std::runtime_error;
+using std::atomic_thread_fence;
+using std::memory_order_relaxed;
+using std::memory_order_acquire;
+using std::memcpy;
+using ii887522::viewify::Point;
+
+namespace ii887522::snake {
+
+StateReader::StateReader(const string& name) : mapping{ OpenFileMappingA(FILE_MAP_READ, FALSE, name.c_str()) }, header{ nullptr } {
+  if (!mapping) throw runtime_error{ "No game is publishing its state under the name given!" };
+  header = static_cast<const SharedStateHeader*>(MapViewOfFile(mapping, FILE_MAP_READ, 0u, 0u, 0u));
+  if (!header || header->magic != SharedStateHeader::MAGIC || header->version != SharedStateHeader::VERSION) {
+    if (header) UnmapViewOfFile(header);
+    CloseHandle(mapping);
+    throw runtime_error{ "The shared state is not in a supported format!" };
+  }
+}
+
+unsigned long long StateReader::getPublishCount() const {
+  return header->publishCount.load(memory_order_acquire);
+}
+
+bool StateReader::read(SharedState*const state, vector<unsigned char>*const cells) const {
+  cells->resize((static_cast<unsigned long long>(header->boardSize.w) * header->boardSize.h + 1u) >> 1u);
+  while (true) {
+    const auto publishCount{ getPublishCount() };
+    if (publishCount == 0u) return false;
+    const auto slot{
+      reinterpret_cast<const SharedStateSlot*>(
+        reinterpret_cast<const char*>(header + 1u) + (publishCount - 1u) % header->slotCount * header->slotSize)
+    };
+    const auto sequence{ slot->sequence.load(memory_order_acquire) };
+    if (sequence & 1u) continue;
+    *state = slot->state;
+    memcpy(cells->data(), reinterpret_cast<const unsigned char*>(slot + 1u), cells->size());
+    atomic_thread_fence(memory_order_acquire);
+    // The slot has been overwritten while it was being copied, so the newer state is read instead
+    if (slot->sequence.load(memory_order_relaxed) == sequence) return true;
+  }
+}
+
+CellType StateReader::getCell(const vector<unsigned char>& cells, const Point<unsigned int>& position) const {
+  const auto index{ static_cast<unsigned long long>(position.y) * header->boardSize.w + position.x };
+  return static_cast<CellType>(cells[index >> 1u] >> ((index & 1u) << 2u) & 0xfu);
+}
+
+StateReader::~StateReader() {
+  UnmapViewOfFile(header);
+  CloseHandle(mapping);
+}
+
+}  // namespace ii887522::snake
@@ -0,0 +1,61 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_STATEREADER_H_
+#define SNAKE_SRC_MAIN_ANY_STATEREADER_H_
+
+#include <windows.h>
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <string>
+#include <vector>
+#include "Enums.h"
+#include "../Struct/SharedStateHeader.h"
+#include "../Struct/SharedState.h"
+
+using std::string;
+using std::vector;
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+// It reads the states published by a StatePublisher in another process without ever blocking it.
+// See also StatePublisher.h for more details
+// Not Thread Safe
+class StateReader final {
+  // remove copy semantics
+  StateReader(const StateReader&) = delete;
+  StateReader& operator=(const StateReader&) = delete;
+
+  // remove move semantics
+  StateReader(StateReader&&) = delete;
+  StateReader& operator=(StateReader&&) = delete;
+
+  HANDLE mapping;
+  const SharedStateHeader* header;
+
+ public:
+  // Param name: the name given to the StatePublisher
+  explicit StateReader(const string& name);
+
+  constexpr const Size<unsigned int>& getBoardSize() const {
+    return header->boardSize;
+  }
+
+  // Return: the number of states published so far, it can be compared to tell whether a new state has been published
+  unsigned long long getPublishCount() const;
+
+  // Copies the latest state published.
+  // Param cells: it is resized to hold the packed cells, see also ../Struct/SharedStateSlot.h for more details
+  // Return: false if nothing has been published yet, true otherwise
+  bool read(SharedState*const state, vector<unsigned char>*const cells) const;
+
+  // Param cells: they must have been read by read()
+  CellType getCell(const vector<unsigned char>& cells, const Point<unsigned int>& position) const;
+
+  ~StateReader();
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_STATEREADER_H_
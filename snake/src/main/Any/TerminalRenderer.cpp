@@ -0,0 +1,109 @@
+// Copyright ii887522
+
+#include "TerminalRenderer.h"
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "Enums.h"
+
+using std::ostream;
+using std::string;
+using std::to_string;
+using std::vector;
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+// Return: the escape sequence which sets the colour of the cell given, the same as on the board
+static constexpr const char* getColor(const CellType cellType) {
+  switch (cellType) {
+    case CellType::WALL: return "\x1b[31m";
+    case CellType::SNAKE_HEAD: return "\x1b[92m";
+    case CellType::SNAKE_BODY: return "\x1b[32m";
+    case CellType::FOOD: return "\x1b[93m";
+    default: return "\x1b[0m";
+  }
+}
+
+// Return: the 2 characters of the cell given, they still tell the cells apart on a terminal without colours
+static constexpr const char* getGlyph(const CellType cellType) {
+  switch (cellType) {
+    case CellType::WALL: return "##";
+    case CellType::SNAKE_HEAD: return "()";
+    case CellType::SNAKE_BODY: return "[]";
+    case CellType::FOOD: return "<>";
+    default: return "  ";
+  }
+}
+
+TerminalRenderer::TerminalRenderer(ostream& output, const Size<unsigned int>& size) : output{ output }, size{ size },
+  cells(static_cast<unsigned long long>(size.w) * size.h, CellType::BACKGROUND), shownCells(cells.size(), CellType::BACKGROUND),
+  hasShown{ false } { }
+
+void TerminalRenderer::moveCursor(const unsigned int row, const unsigned int column) {
+  buffer += "\x1b[";
+  buffer += to_string(row + 1u);
+  buffer += ';';
+  buffer += to_string(column + 1u);
+  buffer += 'H';
+}
+
+void TerminalRenderer::set(const Point<unsigned int>& position, const CellType value) {
+  if (position.x >= size.w || position.y >= size.h) return;
+  cells[static_cast<unsigned long long>(position.y) * size.w + position.x] = value;
+}
+
+void TerminalRenderer::setStatus(const string& value) {
+  status = value;
+}
+
+unsigned int TerminalRenderer::present() {
+  buffer.clear();
+  // The cursor is hidden so that it does not flicker around the cells being written
+  if (!hasShown) buffer += "\x1b[?25l\x1b[0m\x1b[2J";
+  auto cursor{ cells.size() };  // the index of the cell which the cursor is on, it is cells.size() if unknown
+  auto isColorKnown{ false };
+  auto color{ CellType::BACKGROUND };  // the cell type whose colour is being written if isColorKnown
+  for (auto y{ 0u }; y != size.h; ++y) {
+    for (auto x{ 0u }; x != size.w; ++x) {
+      const auto i{ static_cast<unsigned long long>(y) * size.w + x };
+      if (hasShown && cells[i] == shownCells[i]) continue;
+      if (cursor != i) moveCursor(y, x << 1u);
+      if (!isColorKnown || cells[i] != color) {
+        isColorKnown = true;
+        color = cells[i];
+        buffer += getColor(color);
+      }
+      buffer += getGlyph(cells[i]);
+      shownCells[i] = cells[i];
+      // The cursor wraps to the next line after the last column in some terminals but not in the others
+      cursor = x + 1u == size.w ? cells.size() : i + 1u;
+    }
+  }
+  if (!hasShown || status != shownStatus) {
+    moveCursor(size.h, 0u);
+    buffer += "\x1b[0m";
+    buffer += status;
+    buffer += "\x1b[K";
+    shownStatus = status;
+  }
+  hasShown = true;
+  if (buffer.empty()) return 0u;
+  output.write(buffer.data(), buffer.size());
+  output.flush();
+  return static_cast<unsigned int>(buffer.size());
+}
+
+TerminalRenderer::~TerminalRenderer() {
+  if (!hasShown) return;
+  buffer.clear();
+  moveCursor(size.h + 1u, 0u);
+  buffer += "\x1b[0m\x1b[?25h";
+  output.write(buffer.data(), buffer.size());
+  output.flush();
+}
+
+}  // namespace ii887522::snake
@@ -0,0 +1,69 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_TERMINALRENDERER_H_
+#define SNAKE_SRC_MAIN_ANY_TERMINALRENDERER_H_
+
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "Enums.h"
+
+using std::ostream;
+using std::string;
+using std::vector;
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+// It draws a board as a grid of characters in a terminal which understands ANSI escape sequences. Each cell is 2 characters
+// wide so that it looks about square. Only the cells which have changed since the previous frame are written, so a tick
+// usually costs tens of bytes, which suits slow remote connections.
+// Not Thread Safe
+class TerminalRenderer final {
+  // remove copy semantics
+  TerminalRenderer(const TerminalRenderer&) = delete;
+  TerminalRenderer& operator=(const TerminalRenderer&) = delete;
+
+  // remove move semantics
+  TerminalRenderer(TerminalRenderer&&) = delete;
+  TerminalRenderer& operator=(TerminalRenderer&&) = delete;
+
+  ostream& output;
+  const Size<unsigned int> size;  // in cells
+  vector<CellType> cells;  // the next frame
+  vector<CellType> shownCells;  // the frame on the terminal
+  string status;  // the line below the board in the next frame
+  string shownStatus;
+  string buffer;  // the escape sequences of a frame, which are written at once
+  bool hasShown;
+
+  // Appends the escape sequence which moves the cursor to the row and the column given, both of which begin from 0.
+  void moveCursor(const unsigned int row, const unsigned int column);
+
+ public:
+  // Param output: it must be a terminal
+  // Param size: the number of cells shown on each side
+  explicit TerminalRenderer(ostream& output, const Size<unsigned int>& size);
+
+  constexpr const Size<unsigned int>& getSize() const {
+    return size;
+  }
+
+  // Param position: nothing happens if it is outside of the size
+  void set(const Point<unsigned int>& position, const CellType);
+
+  void setStatus(const string&);
+
+  // Writes the difference between the next frame and the frame on the terminal.
+  // Return: the number of bytes written
+  unsigned int present();
+
+  ~TerminalRenderer();
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_TERMINALRENDERER_H_
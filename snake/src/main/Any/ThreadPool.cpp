@@ -0,0 +1,82 @@
+// Copyright ii887522
+
+#include "ThreadPool.h"
+#include <functional>
+#include <vector>
+#include <algorithm>
+#include <thread>  // NOLINT(build/c++11)
+#include <mutex>  // NOLINT(build/c++11)
+#include <condition_variable>  // NOLINT(build/c++11)
+
+using std::function;
+using std::vector;
+using std::min;
+using std::max;
+using std::thread;
+using std::mutex;
+using std::lock_guard;
+using std::unique_lock;
+using std::condition_variable;
+
+namespace ii887522::snake {
+
+ThreadPool::ThreadPool(const unsigned int threadCount) :
+  threadCount{ threadCount == 0u ? max(thread::hardware_concurrency(), 1u) : threadCount }, taskCount{ 0u }, generation{ 0ull },
+  busyCount{ 0u }, isStopping{ false } {
+  for (auto i{ 1u }; i != this->threadCount; ++i) workers.emplace_back([this, i]() { run(i); });
+}
+
+void ThreadPool::run(const unsigned int workerIndex) {
+  auto seenGeneration{ 0ull };
+  while (true) {
+    function<void(unsigned int)> l_job;
+    auto l_taskCount{ 0u };
+    {
+      unique_lock l_lock{ lock };
+      jobCondition.wait(l_lock, [this, seenGeneration]() { return isStopping || generation != seenGeneration; });
+      if (isStopping) return;
+      seenGeneration = generation;
+      l_job = job;
+      l_taskCount = taskCount;
+    }
+    for (auto i{ workerIndex }; i < l_taskCount; i += threadCount) l_job(i);
+    const lock_guard l_lock{ lock };
+    if (--busyCount == 0u) doneCondition.notify_one();
+  }
+}
+
+void ThreadPool::parallelFor(const unsigned int count, const function<void(unsigned int begin, unsigned int end)>& fn) {
+  if (count == 0u) return;
+  // A few ranges per thread evens out ranges which take longer than others
+  const auto l_taskCount{ min(count, threadCount << 2u) };
+  const auto l_job{ [count, l_taskCount, &fn](const unsigned int i) {
+    fn(static_cast<unsigned int>(static_cast<unsigned long long>(count) * i / l_taskCount),
+      static_cast<unsigned int>(static_cast<unsigned long long>(count) * (i + 1u) / l_taskCount));
+  } };
+  if (workers.empty()) {
+    for (auto i{ 0u }; i != l_taskCount; ++i) l_job(i);
+    return;
+  }
+  {
+    const lock_guard l_lock{ lock };
+    job = l_job;
+    taskCount = l_taskCount;
+    busyCount = static_cast<unsigned int>(workers.size());
+    ++generation;
+  }
+  jobCondition.notify_all();
+  for (auto i{ 0u }; i < l_taskCount; i += threadCount) l_job(i);
+  unique_lock l_lock{ lock };
+  doneCondition.wait(l_lock, [this]() { return busyCount == 0u; });
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    const lock_guard l_lock{ lock };
+    isStopping = true;
+  }
+  jobCondition.notify_all();
+  for (auto& worker : workers) worker.join();
+}
+
+}  // namespace ii887522::snake
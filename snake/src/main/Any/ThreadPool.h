@@ -0,0 +1,65 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_THREADPOOL_H_
+#define SNAKE_SRC_MAIN_ANY_THREADPOOL_H_
+
+#include <functional>
+#include <vector>
+#include <thread>  // NOLINT(build/c++11)
+#include <mutex>  // NOLINT(build/c++11)
+#include <condition_variable>  // NOLINT(build/c++11)
+
+using std::function;
+using std::vector;
+using std::thread;
+using std::mutex;
+using std::condition_variable;
+
+namespace ii887522::snake {
+
+// It keeps worker threads alive between parallel loops so that running a loop only costs waking them up. The calling thread
+// works on a share of every loop too. Each share is decided by the task index alone, so which thread runs which task never
+// matters to a loop whose tasks are independent of each other.
+// Not Thread Safe: parallelFor() must only be called from the thread which created the pool
+class ThreadPool final {
+  // remove copy semantics
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  // remove move semantics
+  ThreadPool(ThreadPool&&) = delete;
+  ThreadPool& operator=(ThreadPool&&) = delete;
+
+  const unsigned int threadCount;
+  mutex lock;  // it guards everything below except workers
+  condition_variable jobCondition;
+  condition_variable doneCondition;
+  function<void(unsigned int)> job;  // it runs the task at the index given
+  unsigned int taskCount;
+  unsigned long long generation;  // it is increased whenever a new loop starts
+  unsigned int busyCount;  // the number of workers which have not finished their share of the current loop
+  bool isStopping;
+  vector<thread> workers;
+
+  // Param workerIndex: the share of tasks run by the worker, the calling thread always runs share 0
+  void run(const unsigned int workerIndex);
+
+ public:
+  // Param threadCount: the number of threads running each loop including the calling thread. If it is 0, it is the number of
+  //   hardware threads.
+  explicit ThreadPool(const unsigned int threadCount = 0u);
+
+  constexpr unsigned int getThreadCount() const {
+    return threadCount;
+  }
+
+  // Splits [0, count) into ranges and calls fn with each range on some thread, then returns once every range is done.
+  // Param fn: it is called with the beginning and the end of a range. It may be called from several threads at once.
+  void parallelFor(const unsigned int count, const function<void(unsigned int begin, unsigned int end)>& fn);
+
+  ~ThreadPool();
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_THREADPOOL_H_
@@ -0,0 +1,64 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_TRACERING_H_
+#define SNAKE_SRC_MAIN_ANY_TRACERING_H_
+
+#include <array>
+#include <atomic>
+#include "../Struct/TraceEvent.h"
+
+using std::array;
+using std::atomic;
+using std::memory_order_relaxed;
+using std::memory_order_acquire;
+using std::memory_order_release;
+
+namespace ii887522::snake {
+
+// It is a lock-free ring buffer with exactly 1 producer thread and 1 consumer thread. Events pushed while it is full are dropped
+// rather than blocking the producer.
+// Thread Safe: push() must only be called by the producer thread and drain() must only be called by the consumer thread
+class TraceRing final {
+  // remove copy semantics
+  TraceRing(const TraceRing&) = delete;
+  TraceRing& operator=(const TraceRing&) = delete;
+
+  // remove move semantics
+  TraceRing(TraceRing&&) = delete;
+  TraceRing& operator=(TraceRing&&) = delete;
+
+  static constexpr auto CAPACITY{ 1u << 14u };  // it must be a power of 2
+
+  array<TraceEvent, CAPACITY> events;
+  atomic<unsigned int> head;  // the index of the next event to drain
+  atomic<unsigned int> tail;  // the index of the next event to push
+  atomic<unsigned int> droppedCount;
+
+ public:
+  explicit TraceRing() : head{ 0u }, tail{ 0u }, droppedCount{ 0u } { }
+
+  unsigned int getDroppedCount() const {
+    return droppedCount.load(memory_order_relaxed);
+  }
+
+  void push(const TraceEvent& event) {
+    const auto l_tail{ tail.load(memory_order_relaxed) };
+    if (l_tail - head.load(memory_order_acquire) == CAPACITY) {
+      droppedCount.fetch_add(1u, memory_order_relaxed);
+      return;
+    }
+    events[l_tail & (CAPACITY - 1u)] = event;
+    tail.store(l_tail + 1u, memory_order_release);
+  }
+
+  // Param consume: it is called with every event pushed since the last drain in the order they were pushed
+  template <typename Consumer> void drain(const Consumer& consume) {
+    auto l_head{ head.load(memory_order_relaxed) };
+    for (const auto l_tail{ tail.load(memory_order_acquire) }; l_head != l_tail; ++l_head) consume(events[l_head & (CAPACITY - 1u)]);
+    head.store(l_head, memory_order_release);
+  }
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_TRACERING_H_
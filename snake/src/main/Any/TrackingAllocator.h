@@ -0,0 +1,54 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_TRACKINGALLOCATOR_H_
+#define SNAKE_SRC_MAIN_ANY_TRACKINGALLOCATOR_H_
+
+#include <memory>
+#include <cstddef>
+#include "Enums.h"
+#include "../Struct/MemoryUsage.h"
+#include "../Functions/accounting.h"
+
+using std::allocator;
+
+namespace ii887522::snake {
+
+// It is the standard allocator which charges the memory it allocates to the category given. Unlike other classes, it keeps its
+// copy semantics and it is not final since standard containers copy, rebind and derive from their allocators.
+// See also ../Functions/accounting.h for more details
+// Thread Safe
+template <typename T, MemoryCategory category> class TrackingAllocator {
+ public:
+  using value_type = T;
+
+  template <typename U> struct rebind {
+    using other = TrackingAllocator<U, category>;
+  };
+
+  constexpr TrackingAllocator() noexcept = default;
+
+  template <typename U> constexpr TrackingAllocator(const TrackingAllocator<U, category>&) noexcept { }  // NOLINT(runtime/explicit)
+
+  T* allocate(const size_t count) {
+    const auto result{ allocator<T>{ }.allocate(count) };
+    trackAllocation(category, MemoryUsage{ static_cast<long long>(count * sizeof(T)), 1ll });
+    return result;
+  }
+
+  void deallocate(T*const memory, const size_t count) {
+    trackFree(category, MemoryUsage{ static_cast<long long>(count * sizeof(T)), 1ll });
+    allocator<T>{ }.deallocate(memory, count);
+  }
+
+  template <typename U> constexpr bool operator==(const TrackingAllocator<U, category>&) const noexcept {
+    return true;
+  }
+
+  template <typename U> constexpr bool operator!=(const TrackingAllocator<U, category>&) const noexcept {
+    return false;
+  }
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_TRACKINGALLOCATOR_H_
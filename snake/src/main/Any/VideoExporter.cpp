@@ -0,0 +1,179 @@
+// Copyright ii887522
+
+#include "VideoExporter.h"
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <ostream>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <thread>  // NOLINT(build/c++11)
+#include <mutex>  // NOLINT(build/c++11)
+#include <condition_variable>  // NOLINT(build/c++11)
+#include "Enums.h"
+
+using std::ostream;
+using std::memcpy;
+using std::string;
+using std::to_string;
+using std::vector;
+using std::fill;
+using std::min;
+using std::runtime_error;
+using std::thread;
+using std::unique_lock;
+using std::lock_guard;
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+struct Rgb final {
+  unsigned char r;
+  unsigned char g;
+  unsigned char b;
+};
+
+struct Yuv final {
+  unsigned char y;
+  unsigned char u;
+  unsigned char v;
+};
+
+// Return: the colour of the cell given, the same as in the replay page
+static constexpr Rgb getRgb(const CellType cellType) {
+  switch (cellType) {
+    case CellType::WALL: return Rgb{ 255u, 0u, 0u };
+    case CellType::SNAKE_HEAD: case CellType::SNAKE_BODY: return Rgb{ 0u, 255u, 0u };
+    case CellType::FOOD: return Rgb{ 255u, 255u, 0u };
+    default: return Rgb{ 0u, 0u, 0u };
+  }
+}
+
+// Param value: it must not be negative
+static constexpr unsigned char toByte(const double value) {
+  return static_cast<unsigned char>(min(value + .5, 255.));
+}
+
+// Converts the colour given by full range BT.601 as Y4M C420jpeg expects.
+static constexpr Yuv getYuv(const Rgb& rgb) {
+  return Yuv{
+    toByte(.299 * rgb.r + .587 * rgb.g + .114 * rgb.b), toByte(128. - .168736 * rgb.r - .331264 * rgb.g + .5 * rgb.b),
+    toByte(128. + .5 * rgb.r - .418688 * rgb.g - .081312 * rgb.b)
+  };
+}
+
+VideoExporter::VideoExporter(const string& replayFilePath, const int cellSize, const VideoFormat format, ostream& output) :
+  reader{ replayFilePath }, simulation{ reader.getBoardSize() }, format{ format }, cellSize{ cellSize },
+  frameSize{ reader.getBoardSize().w * cellSize, reader.getBoardSize().h * cellSize }, output{ output }, drawnFrameCount{ 0u },
+  writtenFrameCount{ 0u }, isDrawing{ false } {
+  if (format == VideoFormat::Y4M && cellSize & 1) throw runtime_error{ "VideoExporter cellSize must be even for Y4M!" };
+  const auto pixelCount{ static_cast<unsigned long long>(frameSize.w) * frameSize.h };
+  frame.resize(format == VideoFormat::Y4M ? pixelCount + (pixelCount >> 1u) : pixelCount * 3u);
+  frameSlots.resize(FRAME_SLOT_COUNT, vector<unsigned char>(frame.size()));
+}
+
+void VideoExporter::drawCell(const Point<unsigned int>& position) {
+  const auto rgb{ getRgb(simulation.get(position)) };
+  const auto left{ position.x * cellSize };
+  const auto top{ position.y * cellSize };
+  if (format == VideoFormat::PPM) {
+    for (auto y{ top }; y != top + cellSize; ++y) {
+      auto pixel{ frame.data() + (static_cast<unsigned long long>(y) * frameSize.w + left) * 3u };
+      for (auto x{ 0 }; x != cellSize; ++x) {
+        *pixel++ = rgb.r;
+        *pixel++ = rgb.g;
+        *pixel++ = rgb.b;
+      }
+    }
+    return;
+  }
+  const auto yuv{ getYuv(rgb) };
+  const auto pixelCount{ static_cast<unsigned long long>(frameSize.w) * frameSize.h };
+  for (auto y{ top }; y != top + cellSize; ++y) {
+    const auto row{ frame.data() + static_cast<unsigned long long>(y) * frameSize.w + left };
+    fill(row, row + cellSize, yuv.y);
+  }
+  // Every 2 by 2 pixels share 1 chroma sample, which is exact since cells are aligned to even pixels
+  const auto chromaW{ frameSize.w >> 1u };
+  const auto u{ frame.data() + pixelCount };
+  const auto v{ u + (pixelCount >> 2u) };
+  for (auto y{ top >> 1u }; y != (top + cellSize) >> 1u; ++y) {
+    const auto offset{ static_cast<unsigned long long>(y) * chromaW + (left >> 1u) };
+    fill(u + offset, u + offset + (cellSize >> 1u), yuv.u);
+    fill(v + offset, v + offset + (cellSize >> 1u), yuv.v);
+  }
+}
+
+void VideoExporter::drawBoard() {
+  const auto& size{ simulation.getSize() };
+  for (auto y{ 0u }; y != size.h; ++y) {
+    for (auto x{ 0u }; x != size.w; ++x) drawCell(Point{ x, y });
+  }
+}
+
+void VideoExporter::submitFrame() {
+  unique_lock l_lock{ lock };
+  frameCondition.wait(l_lock, [this]() { return drawnFrameCount - writtenFrameCount != FRAME_SLOT_COUNT; });
+  // The writer never touches the slot which is free
+  l_lock.unlock();
+  memcpy(frameSlots[drawnFrameCount % FRAME_SLOT_COUNT].data(), frame.data(), frame.size());
+  l_lock.lock();
+  ++drawnFrameCount;
+  frameCondition.notify_all();
+}
+
+void VideoExporter::writeFrames() {
+  const auto header{
+    format == VideoFormat::Y4M ? string{ "FRAME\n" } : "P6\n" + to_string(frameSize.w) + " " + to_string(frameSize.h) + "\n255\n"
+  };
+  unique_lock l_lock{ lock };
+  while (true) {
+    frameCondition.wait(l_lock, [this]() { return drawnFrameCount != writtenFrameCount || !isDrawing; });
+    if (drawnFrameCount == writtenFrameCount) return;
+    const auto& frameSlot{ frameSlots[writtenFrameCount % FRAME_SLOT_COUNT] };
+    l_lock.unlock();
+    output.write(header.data(), header.size());
+    output.write(reinterpret_cast<const char*>(frameSlot.data()), frameSlot.size());
+    l_lock.lock();
+    ++writtenFrameCount;
+    frameCondition.notify_all();
+  }
+}
+
+unsigned int VideoExporter::run() {
+  if (format == VideoFormat::Y4M) {
+    output << "YUV4MPEG2 W" << frameSize.w << " H" << frameSize.h << " F1000:" << TICK_DURATION << " Ip A1:1 C420jpeg\n";
+  }
+  reader.seek(0u, &simulation);
+  drawnFrameCount = 0u;
+  writtenFrameCount = 0u;
+  isDrawing = true;
+  thread writer{ [this]() { writeFrames(); } };
+  drawBoard();
+  submitFrame();
+  // A dead snake never ticks again, so a diverged or corrupt replay stops at the tick it died in
+  while (simulation.getTick() < reader.getTickCount() && !simulation.isOver()) {
+    const auto head{ simulation.getBody().front() };
+    const auto tail{ simulation.getBody().back() };
+    const auto food{ simulation.getFood() };
+    reader.stepForward(&simulation);
+    drawCell(head);
+    drawCell(tail);
+    drawCell(food);
+    drawCell(simulation.getBody().front());
+    drawCell(simulation.getFood());
+    submitFrame();
+  }
+  {
+    const lock_guard l_lock{ lock };
+    isDrawing = false;
+    frameCondition.notify_all();
+  }
+  writer.join();
+  return writtenFrameCount;
+}
+
+}  // namespace ii887522::snake
@@ -0,0 +1,80 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_ANY_VIDEOEXPORTER_H_
+#define SNAKE_SRC_MAIN_ANY_VIDEOEXPORTER_H_
+
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <mutex>  // NOLINT(build/c++11)
+#include <condition_variable>  // NOLINT(build/c++11)
+#include "Enums.h"
+#include "ReplayReader.h"
+#include "../Model/Simulation.h"
+
+using std::ostream;
+using std::string;
+using std::vector;
+using std::mutex;
+using std::condition_variable;
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+// It re-simulates a replay without any window and writes 1 frame per tick as uncompressed video, drawn in the same way as the
+// replay page draws the board. Only the cells which have changed since the previous tick are drawn, and frames are written by
+// another thread while the next ones are being drawn, so a replay is exported much faster than it is played.
+//   Y4M: a single YUV 4:2:0 stream at the tick rate which most video tools can read
+//   PPM: binary PPM images one after another, 1 per frame
+// See also ReplayReader.h for more details
+// Not Thread Safe
+class VideoExporter final {
+  // remove copy semantics
+  VideoExporter(const VideoExporter&) = delete;
+  VideoExporter& operator=(const VideoExporter&) = delete;
+
+  // remove move semantics
+  VideoExporter(VideoExporter&&) = delete;
+  VideoExporter& operator=(VideoExporter&&) = delete;
+
+  static constexpr auto TICK_DURATION{ 62u };  // in milliseconds, the same as in the replay page
+  static constexpr auto FRAME_SLOT_COUNT{ 4u };  // the number of frames which can be drawn ahead of the writer
+
+  ReplayReader reader;
+  Simulation simulation;
+  const VideoFormat format;
+  const int cellSize;
+  const Size<unsigned int> frameSize;  // in pixels
+  ostream& output;
+  vector<unsigned char> frame;  // the frame being drawn, in the layout written into the output
+  vector<vector<unsigned char>> frameSlots;  // the frames drawn but not written yet, in a ring
+  mutex lock;  // it guards everything below
+  condition_variable frameCondition;
+  unsigned int drawnFrameCount;
+  unsigned int writtenFrameCount;
+  bool isDrawing;
+
+  void drawCell(const Point<unsigned int>& position);
+  void drawBoard();
+
+  // Hands the frame drawn over to the writer. It blocks while the writer is FRAME_SLOT_COUNT frames behind.
+  void submitFrame();
+
+  void writeFrames();
+
+ public:
+  // Param cellSize: it must be even if the format is Y4M
+  // Param output: the frames are written into it, it must be opened in binary mode
+  explicit VideoExporter(const string& replayFilePath, const int cellSize, const VideoFormat, ostream& output);
+
+  // Writes every frame of the replay and returns once all of them have been written.
+  // Return: the number of frames written
+  unsigned int run();
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_ANY_VIDEOEXPORTER_H_
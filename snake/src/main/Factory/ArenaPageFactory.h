@@ -0,0 +1,182 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_FACTORY_ARENAPAGEFACTORY_H_
+#define SNAKE_SRC_MAIN_FACTORY_ARENAPAGEFACTORY_H_
+
+#ifndef TEST
+
+#include <ViewGroup/Page.h>
+#include <Struct/Point.h>
+#include <Struct/Rect.h>
+#include <Struct/Size.h>
+#include <Any/Reactive.h>
+#include <SDL.h>
+#include <stdexcept>
+#include <chrono>  // NOLINT(build/c++11)
+#include "../Any/Enums.h"
+#include "../Any/GlyphAtlas.h"
+#include "../Any/ThreadPool.h"
+#include "../Model/Arena.h"
+#include "../View/BoardView.h"
+#include "../View/ArenaView.h"
+
+using std::runtime_error;
+using std::chrono::high_resolution_clock;
+using ii887522::viewify::Page;
+using ii887522::viewify::Point;
+using ii887522::viewify::Rect;
+using ii887522::viewify::Size;
+using ii887522::nitro::Reactive;
+
+namespace ii887522::snake {
+
+// Not Thread Safe: it must only be used in main thread
+// See also ../Model/Arena.h for more details
+template <unsigned int viewCount> class ArenaPageFactory final {
+  // remove copy semantics
+  ArenaPageFactory(const ArenaPageFactory&) = delete;
+  ArenaPageFactory& operator=(const ArenaPageFactory&) = delete;
+
+  // remove move semantics
+  ArenaPageFactory(ArenaPageFactory&&) = delete;
+  ArenaPageFactory& operator=(ArenaPageFactory&&) = delete;
+
+ public:
+  // Not Thread Safe
+  class Builder final {
+    // remove copy semantics
+    Builder(const Builder&) = delete;
+    Builder& operator=(const Builder&) = delete;
+
+    // remove move semantics
+    Builder(Builder&&) = delete;
+    Builder& operator=(Builder&&) = delete;
+
+    SDL_Renderer*const renderer;
+    const Size<int> size;
+    Reactive<Path>& currentPath;
+    GlyphAtlas* atlas;
+    bool hasSetAtlas;
+    int cellSize;
+    bool hasSetCellSize;
+    Size<unsigned int> boardSize;
+    bool hasSetBoardSize;
+    unsigned int snakeCount;
+    bool hasSetSnakeCount;
+    unsigned int foodCount;
+    unsigned long long seed;
+    RenderBackend renderBackend;
+
+   public:
+    // Param renderer: it must not be assigned to integer
+    explicit Builder(SDL_Renderer*const renderer, const Size<int>& size, Reactive<Path>*const currentPath) : renderer{ renderer },
+      size{ size }, currentPath{ *currentPath }, atlas{ nullptr }, hasSetAtlas{ false }, cellSize{ 0 }, hasSetCellSize{ false },
+      boardSize{ 0u, 0u }, hasSetBoardSize{ false }, snakeCount{ 0u }, hasSetSnakeCount{ false }, foodCount{ 0u },
+      seed{ static_cast<unsigned long long>(high_resolution_clock::now().time_since_epoch().count()) },
+      renderBackend{ RenderBackend::RENDERER } { }
+
+    // Param value: it must not be assigned to integer. It is the glyph atlas of the stats shown in the header band.
+    // Must Call Time(s): At least 1
+    constexpr Builder& setAtlas(GlyphAtlas*const value) {
+      atlas = value;
+      hasSetAtlas = true;
+      return *this;
+    }
+
+    // Must Call Time(s): At least 1
+    constexpr Builder& setCellSize(const int value) {
+      cellSize = value;
+      hasSetCellSize = true;
+      return *this;
+    }
+
+    // Param value: the number of cells on each side of the board including the walls, each side must be at least 4 cells
+    // Must Call Time(s): At least 1
+    constexpr Builder& setBoardSize(const Size<unsigned int>& value) {
+      boardSize = value;
+      hasSetBoardSize = true;
+      return *this;
+    }
+
+    // Must Call Time(s): At least 1
+    constexpr Builder& setSnakeCount(const unsigned int value) {
+      snakeCount = value;
+      hasSetSnakeCount = true;
+      return *this;
+    }
+
+    // Param value: the number of foods kept on the board, it is 1 for every 2 snakes if it is not set
+    constexpr Builder& setFoodCount(const unsigned int value) {
+      foodCount = value;
+      return *this;
+    }
+
+    // Param value: the same seed always plays the same game, it is taken from the clock if it is not set
+    constexpr Builder& setSeed(const unsigned long long value) {
+      seed = value;
+      return *this;
+    }
+
+    // Param value: how the board is drawn, it is through the renderer if it is not set. See also ../View/BoardView.h for more
+    //   details
+    constexpr Builder& setRenderBackend(const RenderBackend value) {
+      renderBackend = value;
+      return *this;
+    }
+
+    ArenaPageFactory* build() {
+      if (!hasSetAtlas) throw runtime_error{ "ArenaPageFactory atlas is required!" };
+      if (!hasSetCellSize) throw runtime_error{ "ArenaPageFactory cellSize is required!" };
+      if (!hasSetBoardSize) throw runtime_error{ "ArenaPageFactory boardSize is required!" };
+      if (!hasSetSnakeCount) throw runtime_error{ "ArenaPageFactory snakeCount is required!" };
+      if (boardSize.w < 4u || boardSize.h < 4u) throw runtime_error{ "ArenaPageFactory boardSize is too small!" };
+      return new ArenaPageFactory{ *this };
+    }
+
+    friend class ArenaPageFactory;
+  };
+
+ private:
+  SDL_Renderer*const renderer;
+  const Rect<int> rect;
+  const Rect<int> wallRect;
+  Reactive<Path>& currentPath;
+  const GlyphAtlas& atlas;
+  const int cellSize;
+  const RenderBackend renderBackend;
+  ThreadPool threadPool;
+  Arena arena;
+
+  explicit ArenaPageFactory(const Builder& builder, const int headerHeight = 64) : renderer{ builder.renderer },
+    rect{ Rect{ Point{ 0, 0 }, builder.size } },
+    wallRect{ Rect{ Point{ rect.position.x, rect.position.y + headerHeight }, Size{ rect.size.w, rect.size.h - headerHeight } } },
+    currentPath{ builder.currentPath }, atlas{ *builder.atlas }, cellSize{ builder.cellSize },
+    renderBackend{ builder.renderBackend }, threadPool{ },
+    arena{
+      builder.boardSize, builder.snakeCount, builder.foodCount == 0u ? (builder.snakeCount + 1u) >> 1u : builder.foodCount,
+      builder.seed, threadPool
+    } { }
+
+ public:
+  // Return: whether the arena page is showing
+  bool isAnimating() const {
+    return currentPath.get() == Path::ARENA;
+  }
+
+  Page<Path, viewCount>* make() {
+    constexpr auto tickDuration{ 62u };
+    const auto board{ new BoardView{ renderer, wallRect, arena.getCells().getSize(), cellSize, nullptr, renderBackend } };
+    return new Page<Path, viewCount>{ renderer, Point{ 0, 0 }, Path::ARENA, &currentPath, {
+      board,
+      new ArenaView{
+        renderer, &arena, board, atlas, Rect{ rect.position, Size{ rect.size.w, wallRect.position.y - rect.position.y } },
+        &currentPath, cellSize, tickDuration
+      }
+    } };
+  }
+};
+
+}  // namespace ii887522::snake
+
+#endif
+#endif  // SNAKE_SRC_MAIN_FACTORY_ARENAPAGEFACTORY_H_
@@ -10,44 +10,57 @@
 #include <ViewGroup/Page.h>
 #include <Struct/Point.h>
 #include <Struct/Rect.h>
-#include <ViewGroup/Modal.h>
 #include <Struct/Paint.h>
 #include <Struct/Color.h>
 #include <Struct/Size.h>
-#include <Image/Text.h>
-#include <Text/Score.h>
 #include <View/Button.h>
-#include <View/BorderView.h>
-#include <Any/Map.h>
 #include <SDL.h>
-#include <SDL_ttf.h>
 #include <stdexcept>
 #include <random>
+#include <string>
 #include <chrono>  // NOLINT(build/c++11)
 #include "../Any/Enums.h"
+#include "../Any/ReplayWriter.h"
+#include "../Any/StatePublisher.h"
+#include "../Any/FrameProfiler.h"
+#include "../Any/GlyphAtlas.h"
+#include "../Any/CellGrid.h"
+#include "../Any/CursorSwitcher.h"
+#include "../Any/Level.h"
+#include "../Any/MemoryScope.h"
+#include "../Struct/MemoryUsage.h"
+#include "../Struct/OverlayStats.h"
+#include "../Functions/trace.h"
+#include "../Functions/accounting.h"
 #include "../View/Snake.h"
 #include "../View/Food.h"
+#include "../View/ProbeView.h"
+#include "../View/PerfOverlay.h"
+#include "../View/AtlasText.h"
+#include "../View/AtlasScore.h"
+#include "../View/LazyView.h"
+#include "../View/BoardView.h"
+#include "../View/FadeModal.h"
+#include "../View/HitGroup.h"
 
 using std::runtime_error;
 using std::default_random_engine;
+using std::string;
 using std::chrono::high_resolution_clock;
 using ii887522::nitro::Reactive;
 using ii887522::nitro::BinaryReactive;
 using ii887522::viewify::Page;
 using ii887522::viewify::Point;
 using ii887522::viewify::Rect;
-using ii887522::viewify::Modal;
 using ii887522::viewify::Paint;
 using ii887522::viewify::Color;
 using ii887522::viewify::Size;
-using ii887522::viewify::Text;
-using ii887522::viewify::Score;
 using ii887522::viewify::Button;
-using ii887522::viewify::BorderView;
-using ii887522::viewify::Map;
 
 namespace ii887522::snake {
 
+constexpr static auto maxBoardSide{ 10000u };  // in cells
+
 // Not Thread Safe: it must only be used in main thread
 // See also View.h for more details
 template <unsigned int viewCount> class GamePageFactory final {
@@ -73,39 +86,65 @@ template <unsigned int viewCount> class GamePageFactory final {
     SDL_Renderer*const renderer;
     const Size<int> size;
     Reactive<Path>& currentPath;
-    TTF_Font* headFont;
-    bool hasSetHeadFont;
-    TTF_Font* bodyFont;
-    bool hasSetBodyFont;
+    GlyphAtlas* headAtlas;
+    bool hasSetHeadAtlas;
+    GlyphAtlas* bodyAtlas;
+    bool hasSetBodyAtlas;
+    GlyphAtlas* overlayAtlas;
+    bool hasSetOverlayAtlas;
     int cellSize;
     bool hasSetCellSize;
     unsigned int buttonDuration;  // button animation duration
     bool hasSetButtonDuration;
-    SDL_Cursor*const pointer;
+    CursorSwitcher*const cursorSwitcher;
     Size<int> buttonPadding;
     bool hasSetButtonPadding;
+    string replayDirPath;
+    bool hasSetReplayDirPath;
+    string statsDirPath;
+    bool hasSetStatsDirPath;
+    Size<unsigned int> boardSize;
+    bool hasSetBoardSize;
+    const Level* level;
+    string stateName;
+    RenderBackend renderBackend;
+    unsigned int snakeLength;
+    unsigned long long seed;
 
    public:
     // Param renderer: it must not be assigned to integer
-    // Param pointer: it must not be assigned to integer
-    explicit Builder(SDL_Renderer*const renderer, const Size<int>& size, SDL_Cursor*const pointer, Reactive<Path>*const currentPath) :
-      renderer{ renderer }, size{ size }, currentPath{ *currentPath }, headFont{ nullptr }, hasSetHeadFont{ false },
-      bodyFont{ nullptr }, hasSetBodyFont{ false }, cellSize{ 0 }, hasSetCellSize{ false }, buttonDuration{ 0u },
-      hasSetButtonDuration{ false }, pointer{ pointer }, hasSetButtonPadding{ false } { }
+    // Param cursorSwitcher: the cursor is never switched if it is nullptr
+    explicit Builder(SDL_Renderer*const renderer, const Size<int>& size, CursorSwitcher*const cursorSwitcher,
+      Reactive<Path>*const currentPath) :
+      renderer{ renderer }, size{ size }, currentPath{ *currentPath }, headAtlas{ nullptr }, hasSetHeadAtlas{ false },
+      bodyAtlas{ nullptr }, hasSetBodyAtlas{ false },
+      overlayAtlas{ nullptr }, hasSetOverlayAtlas{ false }, cellSize{ 0 }, hasSetCellSize{ false }, buttonDuration{ 0u },
+      hasSetButtonDuration{ false }, cursorSwitcher{ cursorSwitcher }, hasSetButtonPadding{ false }, hasSetReplayDirPath{ false },
+      hasSetStatsDirPath{ false }, boardSize{ 0u, 0u }, hasSetBoardSize{ false }, level{ nullptr },
+      renderBackend{ RenderBackend::RENDERER }, snakeLength{ 0u },
+      seed{ static_cast<unsigned long long>(high_resolution_clock::now().time_since_epoch().count()) } { }
+
+    // Param value: it must not be assigned to integer. It is the glyph atlas of the titles of the modals.
+    // Must Call Time(s): At least 1
+    constexpr Builder& setHeadAtlas(GlyphAtlas*const value) {
+      headAtlas = value;
+      hasSetHeadAtlas = true;
+      return *this;
+    }
 
-    // Param value: it must not be assigned to integer
+    // Param value: it must not be assigned to integer. It is the glyph atlas of the score and the labels of the buttons.
     // Must Call Time(s): At least 1
-    constexpr Builder& setHeadFont(TTF_Font*const value) {
-      headFont = value;
-      hasSetHeadFont = true;
+    constexpr Builder& setBodyAtlas(GlyphAtlas*const value) {
+      bodyAtlas = value;
+      hasSetBodyAtlas = true;
       return *this;
     }
 
-    // Param bodyFont: it must not be assigned to integer
+    // Param value: it must not be assigned to integer. It is the glyph atlas of the performance overlay.
     // Must Call Time(s): At least 1
-    constexpr Builder& setBodyFont(TTF_Font*const value) {
-      bodyFont = value;
-      hasSetBodyFont = true;
+    constexpr Builder& setOverlayAtlas(GlyphAtlas*const value) {
+      overlayAtlas = value;
+      hasSetOverlayAtlas = true;
       return *this;
     }
 
@@ -131,12 +170,83 @@ template <unsigned int viewCount> class GamePageFactory final {
       return *this;
     }
 
+    // Param value: it must end with a slash
+    // Must Call Time(s): At least 1
+    Builder& setReplayDirPath(const string& value) {
+      replayDirPath = value;
+      hasSetReplayDirPath = true;
+      return *this;
+    }
+
+    // Param value: it must end with a slash
+    // Must Call Time(s): At least 1
+    Builder& setStatsDirPath(const string& value) {
+      statsDirPath = value;
+      hasSetStatsDirPath = true;
+      return *this;
+    }
+
+    // Param value: the number of cells on each side of the board including the walls. Each side must be between 4 and
+    // maxBoardSide. If it is not set, the board fits the area below the header exactly.
+    constexpr Builder& setBoardSize(const Size<unsigned int>& value) {
+      boardSize = value;
+      hasSetBoardSize = true;
+      return *this;
+    }
+
+    // Param value: the layout the game is played on, which also decides the board size. If it is not set, the board only has the
+    //   border as walls. Games played on it are neither recorded nor published. See also ../Any/Level.h for more details
+    constexpr Builder& setLevel(const Level*const value) {
+      level = value;
+      return *this;
+    }
+
+    // Param value: the name of the shared memory which the state of the game is published into on every tick. If it is not set,
+    //   the state is not published. See also ../Any/StatePublisher.h for more details
+    Builder& setStateName(const string& value) {
+      stateName = value;
+      return *this;
+    }
+
+    // Param value: how the board is drawn, it is through the renderer if it is not set. See also ../View/BoardView.h for more
+    //   details
+    constexpr Builder& setRenderBackend(const RenderBackend value) {
+      renderBackend = value;
+      return *this;
+    }
+
+    // Param value: the number of segments a new snake is laid with along the serpentine of the board. It is only meant for
+    //   scripted scenarios, games played with it are neither recorded nor published. See also ../View/Snake.h for more details
+    constexpr Builder& setSnakeLength(const unsigned int value) {
+      snakeLength = value;
+      return *this;
+    }
+
+    // Param value: the same seed with the same inputs always plays the same games, it is taken from the clock if it is not set
+    constexpr Builder& setSeed(const unsigned long long value) {
+      seed = value;
+      return *this;
+    }
+
     GamePageFactory* build() {
-      if (!hasSetHeadFont) throw runtime_error{ "GamePageFactory headFont is required!" };
-      if (!hasSetBodyFont) throw runtime_error{ "GamePageFactory bodyFont is required!" };
+      if (!hasSetHeadAtlas) throw runtime_error{ "GamePageFactory headAtlas is required!" };
+      if (!hasSetBodyAtlas) throw runtime_error{ "GamePageFactory bodyAtlas is required!" };
+      if (!hasSetOverlayAtlas) throw runtime_error{ "GamePageFactory overlayAtlas is required!" };
       if (!hasSetCellSize) throw runtime_error{ "GamePageFactory cellSize is required!" };
       if (!hasSetButtonDuration) throw runtime_error{ "GamePageFactory buttonDuration is required!" };
       if (!hasSetButtonPadding) throw runtime_error{ "GamePageFactory buttonPadding is required!" };
+      if (!hasSetReplayDirPath) throw runtime_error{ "GamePageFactory replayDirPath is required!" };
+      if (!hasSetStatsDirPath) throw runtime_error{ "GamePageFactory statsDirPath is required!" };
+      if (level) {
+        boardSize = level->getBoardSize();
+        hasSetBoardSize = true;
+      }
+      if (hasSetBoardSize && (boardSize.w < 4u || boardSize.h < 4u || boardSize.w > maxBoardSide || boardSize.h > maxBoardSide)) {
+        throw runtime_error{ "GamePageFactory boardSize is out of range!" };
+      }
+      if (snakeLength != 0u && hasSetBoardSize && snakeLength >= (boardSize.w - 2u) * (boardSize.h - 2u)) {
+        throw runtime_error{ "GamePageFactory snakeLength is too long!" };
+      }
       return new GamePageFactory{ *this };
     }
 
@@ -144,167 +254,301 @@ template <unsigned int viewCount> class GamePageFactory final {
   };
 
  private:
+  // Both modals share the same layout, and the buttons are positioned relative to the modal
+  static constexpr Size<int> modalSize{ 512, 256 };
+  static constexpr Point<int> backButtonPosition{ 88, 156 };
+  static constexpr Point<int> playAgainButtonPosition{ 232, 156 };
+  static constexpr Size<int> backButtonSize{ 114, 64 };
+  static constexpr Size<int> playAgainButtonSize{ 192, 64 };
+
   SDL_Renderer*const renderer;
   const Rect<int> rect;
   const Rect<int> wallRect;
   Reactive<Path>& currentPath;
-  TTF_Font*const headFont;
-  TTF_Font*const bodyFont;
+  const GlyphAtlas& headAtlas;
+  const GlyphAtlas& bodyAtlas;
+  const GlyphAtlas& overlayAtlas;
   const int cellSize;
+  const Size<unsigned int> boardSize;  // in cells
+  const Level*const level;  // it is nullptr if the board only has the border as walls
+  const RenderBackend renderBackend;
+  const unsigned int snakeLength;  // a new snake is born with 1 segment if it is 0
   const unsigned int buttonDuration;  // button animation duration
   BinaryReactive<bool, bool, bool> isLosingModalShowing;
   BinaryReactive<bool, bool, bool> isWinningModalShowing;
   BinaryReactive<bool, bool, bool> isModalShowing;
   BinaryReactive<bool, bool, bool> canScoreReset;
-  SDL_Cursor*const pointer;
+  CursorSwitcher*const cursorSwitcher;  // it is nullptr if the cursor is never switched
   const Size<int> buttonPadding;
   default_random_engine randomEngine;
   Reactive<bool> isSnakeEatFood;
-  Map<CellType> map;
+  Point<unsigned int> foodPosition;
+  CellGrid map;
+  ReplayWriter replayWriter;
+  StatePublisher*const statePublisher;  // it is nullptr if the state is not published
+  FrameProfiler profiler;
+  OverlayStats overlayStats;
+  PerfOverlay* perfOverlay;  // it is set once the page has been made
+  MemoryUsage watcherUsage;
 
   explicit constexpr GamePageFactory(const Builder& builder, const int headerHeight = 64) : renderer{ builder.renderer },
     rect{ Rect{ Point{ 0, 0 }, builder.size } },
     wallRect{ Rect{ Point{ rect.position.x, rect.position.y + headerHeight }, Size{ rect.size.w, rect.size.h - headerHeight } } },
-    currentPath{ builder.currentPath }, headFont{ builder.headFont }, bodyFont{ builder.bodyFont }, cellSize{ builder.cellSize },
+    currentPath{ builder.currentPath }, headAtlas{ *builder.headAtlas }, bodyAtlas{ *builder.bodyAtlas },
+    overlayAtlas{ *builder.overlayAtlas }, cellSize{ builder.cellSize },
+    boardSize{
+      builder.hasSetBoardSize ? builder.boardSize :
+        Size{ static_cast<unsigned int>(wallRect.size.w / cellSize), static_cast<unsigned int>(wallRect.size.h / cellSize) }
+    }, level{ builder.level }, renderBackend{ builder.renderBackend }, snakeLength{ builder.snakeLength },
     buttonDuration{ builder.buttonDuration }, isLosingModalShowing{ false }, isWinningModalShowing{ false },
     isModalShowing{ &isLosingModalShowing, &isWinningModalShowing, [](const bool*const left, const bool*const right) {
       return *left || *right;
     } },
     canScoreReset{ &isLosingModalShowing, &isWinningModalShowing, [](const bool*const left, const bool*const right) {
       return !(*left || *right);
-    } }, pointer{ builder.pointer }, buttonPadding{ builder.buttonPadding },
-    randomEngine{ static_cast<unsigned int>(high_resolution_clock::now().time_since_epoch().count()) }, isSnakeEatFood{ false },
-    map{ Size{ static_cast<unsigned int>(wallRect.size.w / cellSize), static_cast<unsigned int>(wallRect.size.h / cellSize) } } { }
+    } }, cursorSwitcher{ builder.cursorSwitcher }, buttonPadding{ builder.buttonPadding },
+    randomEngine{ static_cast<unsigned int>(builder.seed) }, isSnakeEatFood{ false },
+    foodPosition{ 0u, 0u }, map{ boardSize, level }, replayWriter{ builder.replayDirPath, boardSize },
+    statePublisher{ builder.stateName.empty() ? nullptr : new StatePublisher{ builder.stateName, boardSize } }, profiler{ builder.statsDirPath, { "BoardView", "Snake", "Food", "LosingModal", "WinningModal", "Score" } },
+    overlayStats{ 0ull, 1u, 0ull }, perfOverlay{ nullptr }, watcherUsage{ 0ll, 0ll } { }
 
-  constexpr unsigned int getBackgroundCellCount() const {
-    return (wallRect.size.w / cellSize - 2u) * (wallRect.size.h / cellSize - 2u);
+  unsigned int getBackgroundCellCount() const {
+    return (boardSize.w - 2u) * (boardSize.h - 2u) - (level ? level->getInnerWallCount() : 0u);
   }
 
  public:
+  // Return: whether the game page is showing a snake moving
+  bool isAnimating() const {
+    return currentPath.get() == Path::GAME && !isModalShowing.get();
+  }
+
+  // Return: whether a game has ended and its modal is showing
+  bool isOver() const {
+    return isModalShowing.get();
+  }
+
+  // Return: the center of the "Play again" button of the modal showing, relative to the page
+  Point<int> getPlayAgainButtonCenter() const {
+    return Point{
+      ((rect.size.w - modalSize.w) >> 1u) + playAgainButtonPosition.x + (playAgainButtonSize.w >> 1u),
+      ((rect.size.h - modalSize.h) >> 1u) + playAgainButtonPosition.y + (playAgainButtonSize.h >> 1u)
+    };
+  }
+
+  FrameProfiler& getProfiler() {
+    return profiler;
+  }
+
+  // It must be called when the page is shown again after it has been suspended, see also ../View/SuspendableView.h for more
+  // details
+  void resume() {
+    if (perfOverlay) perfOverlay->resume();
+  }
+
+  // It is only meant for scripted scenarios. The losing modal is shown as if the snake has hit something if the value is true,
+  // otherwise it is hidden and a new snake is born.
+  void setLosingModalShowing(const bool value) {
+    isLosingModalShowing.set(value);
+  }
+
+  // It is only meant for scripted scenarios. The score goes up and the food is moved as if the snake has eaten it, without the
+  // snake growing.
+  void feed() {
+    map.set(foodPosition, CellType::BACKGROUND);
+    isSnakeEatFood.set(true);
+  }
+
   Page<Path, viewCount>* make() {
-    constexpr Size modalSize{ 512, 256 };
     constexpr auto modalDuration{ 125u };  // modal animation duration
-    constexpr Point backButtonPosition{ 88, 156 };
-    constexpr Point playAgainButtonPosition{ 232, 156 };
+    const auto backgroundCellCount{ getBackgroundCellCount() };
+    watchTracked(&isModalShowing, [this](const bool& value, const int) {
+      if (value) replayWriter.end();
+    }, &watcherUsage);
+    watchTracked(&isLosingModalShowing, [](const bool& value, const int) {
+      if (value) traceInstant("losingModalShown", "simulation");
+    }, &watcherUsage);
+    watchTracked(&isWinningModalShowing, [](const bool& value, const int) {
+      if (value) traceInstant("winningModalShown", "simulation");
+    }, &watcherUsage);
+    watchTracked(&isSnakeEatFood, [this](const bool& value, const int) {
+      if (!value) return;
+      traceInstant("grow", "simulation");
+      ++overlayStats.snakeLength;
+    }, &watcherUsage);
+    const auto board{ new BoardView{ renderer, wallRect, boardSize, cellSize, &profiler, renderBackend, level } };
+    // Every view is surrounded by probes, see also ../Any/FrameProfiler.h for more details
+    // Modals are only built after the page is first shown, and the memory they are built with is charged to the modal trees. See
+    // also ../View/LazyView.h for more details. Each modal fades as a single texture, see also ../View/FadeModal.h for more
+    // details
     return new Page<Path, viewCount>{ renderer, Point{ 0, 0 }, Path::GAME, &currentPath, {
-      new BorderView<CellType>{
-        renderer, wallRect.position, Paint{ wallRect.size, Color{ 255u, 0u, 0u } }, cellSize, &map, CellType::WALL
-      },
+      new ProbeView{ renderer, &profiler, 0u },
+      board,
+      new ProbeView{ renderer, &profiler, 1u },
       Snake::Builder{ renderer, wallRect, cellSize, randomEngine, map, [this]() {
+        traceInstant("hit", "simulation");
         isLosingModalShowing.set(true);
       } }
         .setDead(&isModalShowing)
         .setHasEatFood(&isSnakeEatFood)
+        .setOnReborn([this]() {
+          traceInstant("rebirth", "simulation");
+          // Replays and published states assume that a new snake is born with 1 segment in the middle of a board without walls
+          // inside the border
+          if (snakeLength == 0u && !level) replayWriter.begin();
+          if (statePublisher && snakeLength == 0u && !level) statePublisher->begin();
+          overlayStats.snakeLength = snakeLength == 0u ? 1u : snakeLength;
+        })
+        .setOnMove([this](const Direction direction) {
+          replayWriter.recordMove(direction);
+          if (statePublisher) statePublisher->recordMove(direction);
+          profiler.countTick();
+          ++overlayStats.tickCount;
+        })
+        .setProfiler(&profiler)
+        .setBoard(board)
+        .setLength(snakeLength)
         .build(),
-      new Food{ renderer, wallRect, cellSize, randomEngine, map, &isSnakeEatFood },
-      new Modal<5u>{
-        renderer, rect.size, Point{ (rect.size.w - modalSize.w) >> 1u, (rect.size.h - modalSize.h) >> 1u },
-        Paint{ modalSize, Color{ 255u, 192u, 192u } }, &isLosingModalShowing, modalDuration, {
-          Text::Builder{ renderer, headFont, Point{ 48, 32 }, "GAME OVER!", Color{ 255u, 0u, 0u } }
-            .setA(0u)
-            .setDuration(modalDuration)
-            .build(),
-          Button::Builder{ renderer, backButtonPosition, Paint{ Size{ 114, 64 }, Color{ 0u, 0u, 255u } } }
-            .setA(0u)
-            .setADuration(modalDuration)
-            .setLightnessDuration(buttonDuration)
-            .setOnMouseMove([this]() {
-              SDL_SetCursor(pointer);
-            })
-            .setOnMouseOver([]() {})
-            .setOnMouseOut([]() {
-              SDL_SetCursor(SDL_GetDefaultCursor());
-            })
-            .setOnClick([this]() {
-              isLosingModalShowing.set(false);
-              currentPath.set(Path::MAIN);
-            })
-            .build(),
-          Text::Builder{ renderer, bodyFont, backButtonPosition + buttonPadding, "Back", Color{ 255u, 255u, 255u } }
-            .setA(0u)
-            .setDuration(modalDuration)
-            .build(),
-          Button::Builder{ renderer, playAgainButtonPosition, Paint{ Size{ 192, 64 }, Color{ 255u, 0u, 0u } } }
-            .setA(0u)
-            .setADuration(modalDuration)
-            .setLightnessDuration(buttonDuration)
-            .setOnMouseMove([this]() {
-              SDL_SetCursor(pointer);
-            })
-            .setOnMouseOver([]() {})
-            .setOnMouseOut([]() {
-              SDL_SetCursor(SDL_GetDefaultCursor());
-            })
-            .setOnClick([this]() {
-              isLosingModalShowing.set(false);
-            })
-            .build(),
-          Text::Builder{ renderer, bodyFont, playAgainButtonPosition + buttonPadding, "Play again", Color{ 255u, 255u, 255u } }
-            .setA(0u)
-            .setDuration(modalDuration)
-            .build()
-        }
-      },
-      new Modal<5u>{
-        renderer, rect.size, Point{ (rect.size.w - modalSize.w) >> 1u, (rect.size.h - modalSize.h) >> 1u },
-        Paint{ modalSize, Color{ 192u, 255u, 192u } }, &isWinningModalShowing, modalDuration, {
-          Text::Builder{ renderer, headFont, Point{ 96, 32 }, "YOU WIN!", Color{ 0u, 192u, 0u } }
-            .setA(0u)
-            .setDuration(modalDuration)
-            .build(),
-          Button::Builder{ renderer, backButtonPosition, Paint{ Size{ 114, 64 }, Color{ 0u, 0u, 255u } } }
-            .setA(0u)
-            .setADuration(modalDuration)
-            .setLightnessDuration(buttonDuration)
-            .setOnMouseMove([this]() {
-              SDL_SetCursor(pointer);
-            })
-            .setOnMouseOver([]() {})
-            .setOnMouseOut([]() {
-              SDL_SetCursor(SDL_GetDefaultCursor());
-            })
-            .setOnClick([this]() {
-              isWinningModalShowing.set(false);
-              currentPath.set(Path::MAIN);
-            })
-            .build(),
-          Text::Builder{ renderer, bodyFont, backButtonPosition + buttonPadding, "Back", Color{ 255u, 255u, 255u } }
-            .setA(0u)
-            .setDuration(modalDuration)
-            .build(),
-          Button::Builder{ renderer, playAgainButtonPosition, Paint{ Size{ 192, 64 }, Color{ 0u, 192u, 0u } } }
-            .setA(0u)
-            .setADuration(modalDuration)
-            .setLightnessDuration(buttonDuration)
-            .setOnMouseMove([this]() {
-              SDL_SetCursor(pointer);
-            })
-            .setOnMouseOver([]() {})
-            .setOnMouseOut([]() {
-              SDL_SetCursor(SDL_GetDefaultCursor());
-            })
-            .setOnClick([this]() {
-              isWinningModalShowing.set(false);
-            })
-            .build(),
-          Text::Builder{ renderer, bodyFont, playAgainButtonPosition + buttonPadding, "Play again", Color{ 255u, 255u, 255u } }
-            .setA(0u)
-            .setDuration(modalDuration)
-            .build()
-        }
+      new ProbeView{ renderer, &profiler, 2u },
+      new Food{
+        renderer, wallRect, cellSize, randomEngine, map, &isSnakeEatFood,
+        [this](const Point<unsigned int>& position, const unsigned long long spawnDuration) {
+          traceInstant("foodSpawned", "simulation");
+          foodPosition = position;
+          replayWriter.recordFood(position);
+          if (statePublisher) statePublisher->recordFood(position);
+          overlayStats.lastSpawnDuration = spawnDuration;
+        }, &profiler, board
       },
+      new ProbeView{ renderer, &profiler, 3u },
+      new LazyView{ renderer, "losingModal", [this, modalDuration]() {
+        // Only the buttons react to the mouse
+        const auto buttons{
+          new HitGroup{ renderer, {
+            HitTarget{
+              SDL_Rect{ backButtonPosition.x, backButtonPosition.y, backButtonSize.w, backButtonSize.h },
+              Button::Builder{ renderer, backButtonPosition, Paint{ backButtonSize, Color{ 0u, 0u, 255u } } }
+                .setLightnessDuration(buttonDuration)
+                .setOnMouseMove([]() { })
+                .setOnMouseOver([this]() {
+                  if (cursorSwitcher) cursorSwitcher->enter("losingBack");
+                })
+                .setOnMouseOut([this]() {
+                  if (cursorSwitcher) cursorSwitcher->leave("losingBack");
+                })
+                .setOnClick([this]() {
+                  isLosingModalShowing.set(false);
+                  currentPath.set(Path::MAIN);
+                  if (cursorSwitcher) cursorSwitcher->reset();
+                })
+                .build()
+            },
+            HitTarget{
+              SDL_Rect{ playAgainButtonPosition.x, playAgainButtonPosition.y, playAgainButtonSize.w, playAgainButtonSize.h },
+              Button::Builder{ renderer, playAgainButtonPosition, Paint{ playAgainButtonSize, Color{ 255u, 0u, 0u } } }
+                .setLightnessDuration(buttonDuration)
+                .setOnMouseMove([]() { })
+                .setOnMouseOver([this]() {
+                  if (cursorSwitcher) cursorSwitcher->enter("losingPlayAgain");
+                })
+                .setOnMouseOut([this]() {
+                  if (cursorSwitcher) cursorSwitcher->leave("losingPlayAgain");
+                })
+                .setOnClick([this]() {
+                  isLosingModalShowing.set(false);
+                  if (cursorSwitcher) cursorSwitcher->reset();
+                })
+                .build()
+            }
+          } }
+        };
+        return new FadeModal{
+          renderer, Point{ (rect.size.w - modalSize.w) >> 1u, (rect.size.h - modalSize.h) >> 1u },
+          Paint{ modalSize, Color{ 255u, 192u, 192u } }, &isLosingModalShowing, modalDuration,
+          buttonDuration, &profiler, buttons, {
+            new AtlasText{ renderer, headAtlas, Point{ 48, 32 }, "GAME OVER!", Color{ 255u, 0u, 0u } },
+            buttons,
+            new AtlasText{ renderer, bodyAtlas, backButtonPosition + buttonPadding, "Back", Color{ 255u, 255u, 255u } },
+            new AtlasText{ renderer, bodyAtlas, playAgainButtonPosition + buttonPadding, "Play again", Color{ 255u, 255u, 255u } }
+          }
+        };
+      }, []() { return true; }, MemoryCategory::MODAL_TREES },
+      new ProbeView{ renderer, &profiler, 4u },
+      new LazyView{ renderer, "winningModal", [this, modalDuration]() {
+        // Only the buttons react to the mouse
+        const auto buttons{
+          new HitGroup{ renderer, {
+            HitTarget{
+              SDL_Rect{ backButtonPosition.x, backButtonPosition.y, backButtonSize.w, backButtonSize.h },
+              Button::Builder{ renderer, backButtonPosition, Paint{ backButtonSize, Color{ 0u, 0u, 255u } } }
+                .setLightnessDuration(buttonDuration)
+                .setOnMouseMove([]() { })
+                .setOnMouseOver([this]() {
+                  if (cursorSwitcher) cursorSwitcher->enter("winningBack");
+                })
+                .setOnMouseOut([this]() {
+                  if (cursorSwitcher) cursorSwitcher->leave("winningBack");
+                })
+                .setOnClick([this]() {
+                  isWinningModalShowing.set(false);
+                  currentPath.set(Path::MAIN);
+                  if (cursorSwitcher) cursorSwitcher->reset();
+                })
+                .build()
+            },
+            HitTarget{
+              SDL_Rect{ playAgainButtonPosition.x, playAgainButtonPosition.y, playAgainButtonSize.w, playAgainButtonSize.h },
+              Button::Builder{ renderer, playAgainButtonPosition, Paint{ playAgainButtonSize, Color{ 0u, 192u, 0u } } }
+                .setLightnessDuration(buttonDuration)
+                .setOnMouseMove([]() { })
+                .setOnMouseOver([this]() {
+                  if (cursorSwitcher) cursorSwitcher->enter("winningPlayAgain");
+                })
+                .setOnMouseOut([this]() {
+                  if (cursorSwitcher) cursorSwitcher->leave("winningPlayAgain");
+                })
+                .setOnClick([this]() {
+                  isWinningModalShowing.set(false);
+                  if (cursorSwitcher) cursorSwitcher->reset();
+                })
+                .build()
+            }
+          } }
+        };
+        return new FadeModal{
+          renderer, Point{ (rect.size.w - modalSize.w) >> 1u, (rect.size.h - modalSize.h) >> 1u },
+          Paint{ modalSize, Color{ 192u, 255u, 192u } }, &isWinningModalShowing, modalDuration,
+          buttonDuration, &profiler, buttons, {
+            new AtlasText{ renderer, headAtlas, Point{ 96, 32 }, "YOU WIN!", Color{ 0u, 192u, 0u } },
+            buttons,
+            new AtlasText{ renderer, bodyAtlas, backButtonPosition + buttonPadding, "Back", Color{ 255u, 255u, 255u } },
+            new AtlasText{ renderer, bodyAtlas, playAgainButtonPosition + buttonPadding, "Play again", Color{ 255u, 255u, 255u } }
+          }
+        };
+      }, []() { return true; }, MemoryCategory::MODAL_TREES },
+      new ProbeView{ renderer, &profiler, 5u },
       // Begin glowing views
-      Score::Builder{
-        renderer, bodyFont, Point{ rect.size.w >> 1u, 14 }, Color{ 255u, 255u, 255u }, static_cast<unsigned int>(getBackgroundCellCount() * .75f), [this]() {
+      AtlasScore::Builder{
+        renderer, bodyAtlas, Point{ rect.size.w >> 1u, 14 }, Color{ 255u, 255u, 255u }, static_cast<unsigned int>(backgroundCellCount * .75f), [this]() {
           isWinningModalShowing.set(true);
         }
       }
         .setCanIncrement(&isSnakeEatFood)
         .setCanReset(&canScoreReset)
-        .build()
+        .build(),
       // End glowing views
+      new ProbeView{ renderer, &profiler, 6u },
+      // The overlay is put after the last probe so that it is not charged to any view measured
+      perfOverlay = new PerfOverlay{
+        renderer, overlayAtlas, overlayStats, Rect{ rect.position, Size{ rect.size.w, wallRect.position.y - rect.position.y } },
+        backgroundCellCount
+      }
     } };
   }
+
+  ~GamePageFactory() {
+    trackFree(MemoryCategory::REACTIVE_WATCHERS, watcherUsage);
+    delete statePublisher;
+  }
 };
 
 }  // namespace ii887522::snake
@@ -11,23 +11,26 @@
 #include <Struct/Paint.h>
 #include <Struct/Size.h>
 #include <Any/Reactive.h>
-#include <Image/Text.h>
 #include <View/Button.h>
 #include <View/RectView.h>
 #include <View/BorderView.h>
 #include <SDL.h>
-#include <SDL_ttf.h>
 #include <stdexcept>
+#include <functional>
 #include "../Any/Enums.h"
+#include "../Any/GlyphAtlas.h"
+#include "../Any/CursorSwitcher.h"
+#include "../View/AtlasText.h"
+#include "../View/HitGroup.h"
 
 using std::runtime_error;
+using std::function;
 using ii887522::viewify::Page;
 using ii887522::viewify::Point;
 using ii887522::viewify::Color;
 using ii887522::viewify::Paint;
 using ii887522::viewify::Size;
 using ii887522::nitro::Reactive;
-using ii887522::viewify::Text;
 using ii887522::viewify::Button;
 using ii887522::viewify::RectView;
 using ii887522::viewify::BorderView;
@@ -61,23 +64,25 @@ template <unsigned int viewCount> class MainPageFactory final {
     Reactive<Path>& currentPath;
     int cellSize;
     bool hasSetCellSize;
-    TTF_Font* headFont;
-    bool hasSetHeadFont;
-    TTF_Font* bodyFont;
-    bool hasSetBodyFont;
+    GlyphAtlas* headAtlas;
+    bool hasSetHeadAtlas;
+    GlyphAtlas* bodyAtlas;
+    bool hasSetBodyAtlas;
     unsigned int buttonDuration;  // button animation duration
     bool hasSetButtonDuration;  // has set button animation duration
-    SDL_Cursor*const pointer;
+    CursorSwitcher& cursorSwitcher;
     Size<int> buttonPadding;
     bool hasSetButtonPadding;
+    function<bool()> canPlay;
 
    public:
     // Param renderer: it must not be assigned to integer
-    // Param pointer: it must not be assigned to integer
+    // Param cursorSwitcher: it must not be assigned to integer
     explicit constexpr Builder(SDL_Renderer*const renderer, const Size<int>& size, Reactive<Path>*const currentPath,
-      SDL_Cursor*const pointer) : renderer{ renderer }, size{ size }, currentPath{ *currentPath }, cellSize{ 0 },
-      hasSetCellSize{ false }, headFont{ nullptr }, hasSetHeadFont{ false }, bodyFont{ nullptr }, hasSetBodyFont{ false },
-      buttonDuration{ 0u }, hasSetButtonDuration{ false }, pointer{ pointer }, hasSetButtonPadding{ false } { }
+      CursorSwitcher*const cursorSwitcher) : renderer{ renderer }, size{ size }, currentPath{ *currentPath }, cellSize{ 0 },
+      hasSetCellSize{ false }, headAtlas{ nullptr }, hasSetHeadAtlas{ false }, bodyAtlas{ nullptr }, hasSetBodyAtlas{ false },
+      buttonDuration{ 0u }, hasSetButtonDuration{ false }, cursorSwitcher{ *cursorSwitcher }, hasSetButtonPadding{ false },
+      canPlay{ []() { return true; } } { }
 
     // Must Call Time(s): At least 1
     constexpr Builder& setCellSize(const int value) {
@@ -88,17 +93,17 @@ template <unsigned int viewCount> class MainPageFactory final {
 
     // Param value: it must not be assigned to integer
     // Must Call Time(s): At least 1
-    constexpr Builder& setHeadFont(TTF_Font*const value) {
-      headFont = value;
-      hasSetHeadFont = true;
+    constexpr Builder& setHeadAtlas(GlyphAtlas*const value) {
+      headAtlas = value;
+      hasSetHeadAtlas = true;
       return *this;
     }
 
     // Param value: it must not be assigned to integer
     // Must Call Time(s): At least 1
-    constexpr Builder& setBodyFont(TTF_Font*const value) {
-      bodyFont = value;
-      hasSetBodyFont = true;
+    constexpr Builder& setBodyAtlas(GlyphAtlas*const value) {
+      bodyAtlas = value;
+      hasSetBodyAtlas = true;
       return *this;
     }
 
@@ -117,10 +122,17 @@ template <unsigned int viewCount> class MainPageFactory final {
       return *this;
     }
 
+    // Param value: it tells whether the game page is ready to be navigated to. The play button does nothing until then. If it is
+    //   not set, the play button always navigates.
+    Builder& setCanPlay(const function<bool()>& value) {
+      canPlay = value;
+      return *this;
+    }
+
     MainPageFactory* build() {
       if (!hasSetCellSize) throw runtime_error{ "MainPageFactory cellSize is required!" };
-      if (!hasSetHeadFont) throw runtime_error{ "MainPageFactory headFont is required!" };
-      if (!hasSetBodyFont) throw runtime_error{ "MainPageFactory bodyFont is required!" };
+      if (!hasSetHeadAtlas) throw runtime_error{ "MainPageFactory headAtlas is required!" };
+      if (!hasSetBodyAtlas) throw runtime_error{ "MainPageFactory bodyAtlas is required!" };
       if (!hasSetButtonDuration) throw runtime_error{ "MainPageFactory buttonDuration is required!" };
       if (!hasSetButtonPadding) throw runtime_error{ "MainPageFactory buttonPadding is required!" };
       return new MainPageFactory{ *this };
@@ -134,19 +146,24 @@ template <unsigned int viewCount> class MainPageFactory final {
   const Size<int> size;
   Reactive<Path>& currentPath;
   const int cellSize;
-  TTF_Font*const headFont;
-  TTF_Font*const bodyFont;
+  const GlyphAtlas& headAtlas;
+  const GlyphAtlas& bodyAtlas;
   const unsigned int buttonDuration;  // button animation duration
-  SDL_Cursor*const pointer;
+  CursorSwitcher& cursorSwitcher;
   const Size<int> buttonPadding;
+  const function<bool()> canPlay;
 
-  explicit constexpr MainPageFactory(const Builder& builder) : renderer{ builder.renderer }, size{ builder.size },
-    currentPath{ builder.currentPath }, cellSize{ builder.cellSize }, headFont{ builder.headFont }, bodyFont{ builder.bodyFont },
-    buttonDuration{ builder.buttonDuration }, pointer{ builder.pointer }, buttonPadding{ builder.buttonPadding } { }
+  explicit MainPageFactory(const Builder& builder) : renderer{ builder.renderer }, size{ builder.size },
+    currentPath{ builder.currentPath }, cellSize{ builder.cellSize }, headAtlas{ *builder.headAtlas }, bodyAtlas{ *builder.bodyAtlas },
+    buttonDuration{ builder.buttonDuration }, cursorSwitcher{ builder.cursorSwitcher }, buttonPadding{ builder.buttonPadding },
+    canPlay{ builder.canPlay } { }
 
  public:
   Page<Path, viewCount>* make() {
     constexpr Point playButtonPosition{ 324, 592 };
+    constexpr Point replayButtonPosition{ 306, 672 };
+    constexpr Size playButtonSize{ 102, 64 };
+    constexpr Size replayButtonSize{ 140, 64 };
     constexpr Size keySize{ 62, 62 };
     constexpr Size keyMargin{ 16, 16 };
     constexpr Point wKeyPosition{ 272, 208 };
@@ -158,57 +175,74 @@ template <unsigned int viewCount> class MainPageFactory final {
     constexpr Size sKeyPadding{ 20, 14 };
     constexpr Size dKeyPadding{ 20, 14 };
     return new Page<Path, viewCount>{ renderer, Point{ 0, 0 }, Path::MAIN, &currentPath, {
-      Text::Builder{ renderer, headFont, Point{ 288, 80 }, "Snake", Color{ 0u, 255u, 0u } }.setDuration(1u).build(),
+      new AtlasText{ renderer, headAtlas, Point{ 288, 80 }, "Snake", Color{ 0u, 255u, 0u } },
       new RectView{ renderer, wKeyPosition, Paint{ keySize, Color{ 255u, 255u, 255u } } },
-      Text::Builder{ renderer, bodyFont, wKeyPosition + wKeyPadding, "W" }.setDuration(1u).build(),
-      Text::Builder{
-        renderer, bodyFont, Point{ wKeyPosition.x + keySize.w + keyMargin.w, wKeyPosition.y + wKeyPadding.h }, "Move up",
+      new AtlasText{ renderer, bodyAtlas, wKeyPosition + wKeyPadding, "W" },
+      new AtlasText{
+        renderer, bodyAtlas, Point{ wKeyPosition.x + keySize.w + keyMargin.w, wKeyPosition.y + wKeyPadding.h }, "Move up",
         Color{ 255u, 255u, 255u }
-      }
-        .setDuration(1u)
-        .build(),
+      },
       new RectView{ renderer, aKeyPosition, Paint{ keySize, Color{ 255u, 255u, 255u } } },
-      Text::Builder{ renderer, bodyFont, aKeyPosition + aKeyPadding, "A" }.setDuration(1u).build(),
-      Text::Builder{
-        renderer, bodyFont, Point{ aKeyPosition.x + keySize.w + keyMargin.w, aKeyPosition.y + aKeyPadding.h }, "Move left",
+      new AtlasText{ renderer, bodyAtlas, aKeyPosition + aKeyPadding, "A" },
+      new AtlasText{
+        renderer, bodyAtlas, Point{ aKeyPosition.x + keySize.w + keyMargin.w, aKeyPosition.y + aKeyPadding.h }, "Move left",
         Color{ 255u, 255u, 255u }
-      }
-        .setDuration(1u)
-        .build(),
+      },
       new RectView{ renderer, sKeyPosition, Paint{ keySize, Color{ 255u, 255u, 255u } } },
-      Text::Builder{ renderer, bodyFont, sKeyPosition + sKeyPadding, "S" }.setDuration(1u).build(),
-      Text::Builder{
-        renderer, bodyFont, Point{ sKeyPosition.x + keySize.w + keyMargin.w, sKeyPosition.y + sKeyPadding.h }, "Move down",
+      new AtlasText{ renderer, bodyAtlas, sKeyPosition + sKeyPadding, "S" },
+      new AtlasText{
+        renderer, bodyAtlas, Point{ sKeyPosition.x + keySize.w + keyMargin.w, sKeyPosition.y + sKeyPadding.h }, "Move down",
         Color{ 255u, 255u, 255u }
-      }
-        .setDuration(1u)
-        .build(),
+      },
       new RectView{ renderer, dKeyPosition, Paint{ keySize, Color{ 255u, 255u, 255u } } },
-      Text::Builder{ renderer, bodyFont, dKeyPosition + dKeyPadding, "D" }.setDuration(1u).build(),
-      Text::Builder{
-        renderer, bodyFont, Point{ dKeyPosition.x + keySize.w + keyMargin.w, dKeyPosition.y + dKeyPadding.h }, "Move right",
+      new AtlasText{ renderer, bodyAtlas, dKeyPosition + dKeyPadding, "D" },
+      new AtlasText{
+        renderer, bodyAtlas, Point{ dKeyPosition.x + keySize.w + keyMargin.w, dKeyPosition.y + dKeyPadding.h }, "Move right",
         Color{ 255u, 255u, 255u }
-      }
-        .setDuration(1u)
-        .build(),
-      Button::Builder{ renderer, playButtonPosition, Paint{ Size{ 102, 64 }, Color{ 0u, 0u, 255u } } }
-        .setADuration(1u)
-        .setLightnessDuration(buttonDuration)
-        .setOnMouseMove([this]() {
-          SDL_SetCursor(pointer);
-        })
-        .setOnMouseOver([]() { })
-        .setOnMouseOut([]() {
-          SDL_SetCursor(SDL_GetDefaultCursor());
-        })
-        .setOnClick([this]() {
-          currentPath.set(Path::GAME);
-          SDL_SetCursor(SDL_GetDefaultCursor());
-        })
-        .build(),
-      Text::Builder{ renderer, bodyFont, playButtonPosition + buttonPadding, "Play", Color{ 255u, 255u, 255u } }
-        .setDuration(1u)
-        .build()
+      },
+      // Only the buttons react to the mouse
+      new HitGroup{ renderer, {
+        HitTarget{
+          SDL_Rect{ playButtonPosition.x, playButtonPosition.y, playButtonSize.w, playButtonSize.h },
+          Button::Builder{ renderer, playButtonPosition, Paint{ playButtonSize, Color{ 0u, 0u, 255u } } }
+            .setADuration(1u)
+            .setLightnessDuration(buttonDuration)
+            .setOnMouseMove([]() { })
+            .setOnMouseOver([this]() {
+              cursorSwitcher.enter("play");
+            })
+            .setOnMouseOut([this]() {
+              cursorSwitcher.leave("play");
+            })
+            .setOnClick([this]() {
+              // Navigating before the game page is built would show nothing
+              if (!canPlay()) return;
+              currentPath.set(Path::GAME);
+              cursorSwitcher.reset();
+            })
+            .build()
+        },
+        HitTarget{
+          SDL_Rect{ replayButtonPosition.x, replayButtonPosition.y, replayButtonSize.w, replayButtonSize.h },
+          Button::Builder{ renderer, replayButtonPosition, Paint{ replayButtonSize, Color{ 0u, 192u, 0u } } }
+            .setADuration(1u)
+            .setLightnessDuration(buttonDuration)
+            .setOnMouseMove([]() { })
+            .setOnMouseOver([this]() {
+              cursorSwitcher.enter("replay");
+            })
+            .setOnMouseOut([this]() {
+              cursorSwitcher.leave("replay");
+            })
+            .setOnClick([this]() {
+              currentPath.set(Path::REPLAY);
+              cursorSwitcher.reset();
+            })
+            .build()
+        }
+      } },
+      new AtlasText{ renderer, bodyAtlas, playButtonPosition + buttonPadding, "Play", Color{ 255u, 255u, 255u } },
+      new AtlasText{ renderer, bodyAtlas, replayButtonPosition + buttonPadding, "Replay", Color{ 255u, 255u, 255u } }
     } };
   }
 };
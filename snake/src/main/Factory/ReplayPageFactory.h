@@ -0,0 +1,116 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_FACTORY_REPLAYPAGEFACTORY_H_
+#define SNAKE_SRC_MAIN_FACTORY_REPLAYPAGEFACTORY_H_
+
+#ifndef TEST
+
+#include <ViewGroup/Page.h>
+#include <Struct/Point.h>
+#include <Struct/Rect.h>
+#include <Struct/Size.h>
+#include <Any/Reactive.h>
+#include <SDL.h>
+#include <stdexcept>
+#include <string>
+#include "../Any/Enums.h"
+#include "../View/ReplayView.h"
+
+using std::runtime_error;
+using std::string;
+using ii887522::viewify::Page;
+using ii887522::viewify::Point;
+using ii887522::viewify::Rect;
+using ii887522::viewify::Size;
+using ii887522::nitro::Reactive;
+
+namespace ii887522::snake {
+
+// Not Thread Safe: it must only be used in main thread
+// See also View.h for more details
+template <unsigned int viewCount> class ReplayPageFactory final {
+  // remove copy semantics
+  ReplayPageFactory(const ReplayPageFactory&) = delete;
+  ReplayPageFactory& operator=(const ReplayPageFactory&) = delete;
+
+  // remove move semantics
+  ReplayPageFactory(ReplayPageFactory&&) = delete;
+  ReplayPageFactory& operator=(ReplayPageFactory&&) = delete;
+
+ public:
+  // Not Thread Safe
+  class Builder final {
+    // remove copy semantics
+    Builder(const Builder&) = delete;
+    Builder& operator=(const Builder&) = delete;
+
+    // remove move semantics
+    Builder(Builder&&) = delete;
+    Builder& operator=(Builder&&) = delete;
+
+    SDL_Renderer*const renderer;
+    const Size<int> size;
+    Reactive<Path>& currentPath;
+    int cellSize;
+    bool hasSetCellSize;
+    string replayDirPath;
+    bool hasSetReplayDirPath;
+
+   public:
+    // Param renderer: it must not be assigned to integer
+    explicit Builder(SDL_Renderer*const renderer, const Size<int>& size, Reactive<Path>*const currentPath) : renderer{ renderer },
+      size{ size }, currentPath{ *currentPath }, cellSize{ 0 }, hasSetCellSize{ false }, hasSetReplayDirPath{ false } { }
+
+    // Must Call Time(s): At least 1
+    constexpr Builder& setCellSize(const int value) {
+      cellSize = value;
+      hasSetCellSize = true;
+      return *this;
+    }
+
+    // Param value: it must end with a slash
+    // Must Call Time(s): At least 1
+    Builder& setReplayDirPath(const string& value) {
+      replayDirPath = value;
+      hasSetReplayDirPath = true;
+      return *this;
+    }
+
+    ReplayPageFactory* build() {
+      if (!hasSetCellSize) throw runtime_error{ "ReplayPageFactory cellSize is required!" };
+      if (!hasSetReplayDirPath) throw runtime_error{ "ReplayPageFactory replayDirPath is required!" };
+      return new ReplayPageFactory{ *this };
+    }
+
+    friend class ReplayPageFactory;
+  };
+
+ private:
+  SDL_Renderer*const renderer;
+  const Rect<int> wallRect;
+  Reactive<Path>& currentPath;
+  const int cellSize;
+  const string replayDirPath;
+  ReplayView* replayView;
+
+  explicit ReplayPageFactory(const Builder& builder, const int headerHeight = 64) : renderer{ builder.renderer },
+    wallRect{ Rect{ Point{ 0, headerHeight }, Size{ builder.size.w, builder.size.h - headerHeight } } },
+    currentPath{ builder.currentPath }, cellSize{ builder.cellSize }, replayDirPath{ builder.replayDirPath }, replayView{ nullptr } { }
+
+ public:
+  // Return: whether the replay page is showing a replay being played
+  bool isAnimating() const {
+    return currentPath.get() == Path::REPLAY && replayView && replayView->isAnimating();
+  }
+
+  Page<Path, viewCount>* make() {
+    return new Page<Path, viewCount>{ renderer, Point{ 0, 0 }, Path::REPLAY, &currentPath, {
+      replayView = new ReplayView{ renderer, replayDirPath, wallRect, cellSize, &currentPath }
+    } };
+  }
+};
+
+}  // namespace ii887522::snake
+
+#endif
+#endif  // SNAKE_SRC_MAIN_FACTORY_REPLAYPAGEFACTORY_H_
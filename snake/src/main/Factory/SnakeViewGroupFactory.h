@@ -11,11 +11,32 @@
 #include <View/ViewGroup.h>
 #include <Struct/Size.h>
 #include <Struct/Point.h>
+#include <functional>
+#include <string>
 #include <Any/Reactive.h>
 #include "../Any/Enums.h"
+#include "../Any/GlyphAtlas.h"
+#include "../Any/AssetLoader.h"
+#include "../Any/IdleMonitor.h"
+#include "../Any/StartupTimeline.h"
+#include "../Any/CursorSwitcher.h"
+#include "../Any/Level.h"
+#include "../Any/MemoryScope.h"
+#include "../Struct/MemoryUsage.h"
+#include "../Functions/accounting.h"
+#include "../View/LazyView.h"
+#include "../View/StartupProbeView.h"
+#include "../View/AssetUploadView.h"
+#include "../View/IdleView.h"
+#include "../View/SessionRecorder.h"
+#include "../View/SuspendableView.h"
 #include "MainPageFactory.h"
 #include "GamePageFactory.h"
+#include "ReplayPageFactory.h"
+#include "ArenaPageFactory.h"
 
+using std::function;
+using std::string;
 using ii887522::viewify::ViewGroupFactory;
 using ii887522::viewify::ViewGroup;
 using ii887522::viewify::Size;
@@ -24,8 +45,11 @@ using ii887522::nitro::Reactive;
 
 namespace ii887522::snake {
 
-constexpr static auto mainPageViewCount{ 15u };
-constexpr static auto gamePageViewCount{ 6u };
+constexpr static auto appViewCount{ 4u };
+constexpr static auto mainPageViewCount{ 16u };
+constexpr static auto gamePageViewCount{ 14u };
+constexpr static auto replayPageViewCount{ 1u };
+constexpr static auto arenaPageViewCount{ 2u };
 
 // See also ../View/ViewGroup.h for more details
 template <unsigned int viewCount> class SnakeViewGroupFactory final : public ViewGroupFactory<viewCount> {
@@ -37,50 +61,198 @@ template <unsigned int viewCount> class SnakeViewGroupFactory final : public Vie
   SnakeViewGroupFactory(SnakeViewGroupFactory&&) = delete;
   SnakeViewGroupFactory& operator=(SnakeViewGroupFactory&&) = delete;
 
-  TTF_Font*const headFont;
-  TTF_Font*const bodyFont;
+  StartupTimeline& startupTimeline;
+  const Size<unsigned int> boardSize;  // in cells, the board fits the window if it is 0 by 0
+  const unsigned int arenaSnakeCount;  // the arena page is not built if it is 0
+  const string stateName;  // the state of the game is not published if it is empty
+  const RenderBackend renderBackend;
+  const unsigned long long seed;
+  const string sessionFilePath;  // the session is not recorded if it is empty
+  const Level*const level;  // it is nullptr if the game board only has the border as walls
+  const bool isPlayback;
+  AssetLoader*const assetLoader;
   SDL_Cursor*const pointer;
+  CursorSwitcher cursorSwitcher;
+  GlyphAtlas* headAtlas;
+  GlyphAtlas* bodyAtlas;
+  GlyphAtlas* overlayAtlas;
   Reactive<Path> currentPath;
   MainPageFactory<mainPageViewCount>* mainPageFactory;
   GamePageFactory<gamePageViewCount>* gamePageFactory;
+  ReplayPageFactory<replayPageViewCount>* replayPageFactory;
+  ArenaPageFactory<arenaPageViewCount>* arenaPageFactory;
+  IdleMonitor idleMonitor;
+
+  // Opens the font and bakes it into the atlas given in the background. The font is closed right after baking as every text is
+  // drawn from the atlases, and the memory it is opened with is charged to the fonts until then. If the font cannot be opened, the
+  // error is logged and the atlas is left drawing placeholders.
+  void loadFont(GlyphAtlas*const atlas, const int ptSize) {
+    assetLoader->load([atlas, ptSize]() {
+      const MemoryScope memoryScope{ MemoryCategory::FONTS };
+      const auto font{ TTF_OpenFont("res/main/arial.ttf", ptSize) };
+      const auto fontUsage{ memoryScope.end() };
+      if (!font) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to open the font: %s", TTF_GetError());
+        trackFree(MemoryCategory::FONTS, fontUsage);
+        return function<void(bool)>{ [](const bool) { } };
+      }
+      atlas->bake(font);
+      TTF_CloseFont(font);
+      trackFree(MemoryCategory::FONTS, fontUsage);
+      return function<void(bool)>{ [atlas](const bool isUploading) {
+        // The atlas may have been freed already if it is not uploading
+        if (isUploading) atlas->upload();
+      } };
+    });
+  }
 
  public:
+  // Param startupTimeline: the phases of building the first page are marked into it
+  // Param boardSize: the number of cells on each side of the game board including the walls, or 0 by 0 to fit the window
+  // Param arenaSnakeCount: if it is not 0, the app starts in an arena played by that many bots instead of the main page
+  // Param stateName: if it is not empty, the state of the game is published under that name, see also ../Any/StatePublisher.h
+  //   for more details
+  // Param renderBackend: how the boards are drawn, see also ../View/BoardView.h for more details
+  // Param seed: the same seed with the same inputs always plays the same games
+  // Param sessionFilePath: if it is not empty, every input and frame is recorded into that file, see also
+  //   ../View/SessionRecorder.h for more details
+  // Param level: if it is not nullptr, the game is played on it and boardSize is ignored, see also ../Any/Level.h for more details
+  // Param isPlayback: if it is true, the app never idles and neither reads nor writes replays and stats, so that a recorded
+  //   session plays the same way every time, see also ../Any/SessionPlayer.h for more details
   // See also ../View/ViewGroup.h for more details
-  explicit constexpr SnakeViewGroupFactory() : ViewGroupFactory<viewCount>{ }, headFont{ TTF_OpenFont("res/main/arial.ttf", 64) },
-    bodyFont{ TTF_OpenFont("res/main/arial.ttf", 32) }, pointer{ SDL_CreateSystemCursor(SDL_SYSTEM_CURSOR_HAND) },
-    currentPath{ Path::MAIN }, mainPageFactory{ nullptr }, gamePageFactory{ nullptr } { }
+  explicit SnakeViewGroupFactory(StartupTimeline*const startupTimeline, const Size<unsigned int>& boardSize = Size{ 0u, 0u },
+    const unsigned int arenaSnakeCount = 0u, const string& stateName = "", const RenderBackend renderBackend = RenderBackend::RENDERER,
+    const unsigned long long seed = 0ull, const string& sessionFilePath = "", const Level*const level = nullptr,
+    const bool isPlayback = false) :
+    ViewGroupFactory<viewCount>{ },
+    startupTimeline{ *startupTimeline }, boardSize{ boardSize }, arenaSnakeCount{ arenaSnakeCount }, stateName{ stateName },
+    renderBackend{ renderBackend }, seed{ seed }, sessionFilePath{ sessionFilePath }, level{ level }, isPlayback{ isPlayback },
+    assetLoader{ new AssetLoader }, pointer{ SDL_CreateSystemCursor(SDL_SYSTEM_CURSOR_HAND) },
+    cursorSwitcher{ pointer }, headAtlas{ nullptr }, bodyAtlas{ nullptr }, overlayAtlas{ nullptr },
+    currentPath{ arenaSnakeCount == 0u ? Path::MAIN : Path::ARENA }, mainPageFactory{ nullptr }, gamePageFactory{ nullptr },
+    replayPageFactory{ nullptr }, arenaPageFactory{ nullptr }, idleMonitor{ 250u, isPlayback ? 0u : 1000u } { }
+
+  // Return: whether every font and glyph atlas has been loaded and uploaded
+  bool isLoaded() const {
+    return assetLoader->isIdle();
+  }
 
   // Param renderer: it must not be assigned to integer
   ViewGroup<viewCount> make(SDL_Renderer*const renderer, const Size<int>& size) override {
     constexpr auto cellSize{ 16 };
     constexpr auto buttonDuration{ 125u };  // button animation duration
     constexpr Size buttonPadding{ 20, 12 };
+    const auto replayDirPath{ isPlayback ? "" : "replays/" };
+    const auto statsDirPath{ isPlayback ? "" : "stats/" };
+    startupTimeline.mark("window");
+    // Each font size is baked into a glyph atlas once and shared by every label and score drawn in that size. They are loaded in
+    // the background and texts are drawn as placeholders until then.
+    headAtlas = new GlyphAtlas{ renderer, 64 };
+    bodyAtlas = new GlyphAtlas{ renderer, 32 };
+    overlayAtlas = new GlyphAtlas{ renderer, 14 };
+    loadFont(headAtlas, 64);
+    loadFont(bodyAtlas, 32);
+    loadFont(overlayAtlas, 14);
+    // Pages which are not the current one are neither stepped nor rendered, see also ../View/SuspendableView.h for more details
+    mainPageFactory = MainPageFactory<mainPageViewCount>::Builder{ renderer, size, &currentPath, &cursorSwitcher }
+      .setHeadAtlas(headAtlas)
+      .setBodyAtlas(bodyAtlas)
+      .setButtonDuration(buttonDuration)
+      .setButtonPadding(buttonPadding)
+      .setCellSize(cellSize)
+      .setCanPlay([this]() {
+        // The factory is set while the game page is being built
+        return gamePageFactory != nullptr;
+      })
+      .build();
+    const auto mainPage{
+      new SuspendableView{ renderer, mainPageFactory->make(), [this]() {
+        return currentPath.get() == Path::MAIN;
+      } }
+    };
+    startupTimeline.mark("mainPage");
+    // Pages which are not shown first are only built after the first frame
+    const auto gamePage{
+      new LazyView{ renderer, "gamePage", [this, renderer, size, cellSize, buttonDuration, buttonPadding, replayDirPath, statsDirPath]() {
+        auto builder{ GamePageFactory<gamePageViewCount>::Builder{ renderer, size, &cursorSwitcher, &currentPath } };
+        if (boardSize.w != 0u && boardSize.h != 0u) builder.setBoardSize(boardSize);
+        gamePageFactory = builder
+          .setHeadAtlas(headAtlas)
+          .setBodyAtlas(bodyAtlas)
+          .setOverlayAtlas(overlayAtlas)
+          .setButtonDuration(buttonDuration)
+          .setButtonPadding(buttonPadding)
+          .setCellSize(cellSize)
+          .setReplayDirPath(replayDirPath)
+          .setStatsDirPath(statsDirPath)
+          .setStateName(stateName)
+          .setRenderBackend(renderBackend)
+          .setSeed(seed)
+          .setLevel(level)
+          .build();
+        return new SuspendableView{ renderer, gamePageFactory->make(), [this]() {
+          return currentPath.get() == Path::GAME;
+        }, [this]() {
+          gamePageFactory->resume();
+        } };
+      }, [this]() {
+        // The game page draws its labels from the atlases, so it waits until they have been uploaded
+        return assetLoader->isIdle();
+      } }
+    };
+    const auto replayPage{
+      new LazyView{ renderer, "replayPage", [this, renderer, size, cellSize, replayDirPath]() {
+        replayPageFactory = ReplayPageFactory<replayPageViewCount>::Builder{ renderer, size, &currentPath }
+          .setCellSize(cellSize)
+          .setReplayDirPath(replayDirPath)
+          .build();
+        return new SuspendableView{ renderer, replayPageFactory->make(), [this]() {
+          return currentPath.get() == Path::REPLAY;
+        } };
+      } }
+    };
+    const auto arenaPage{
+      new LazyView{ renderer, "arenaPage", [this, renderer, size, cellSize]() {
+        arenaPageFactory = ArenaPageFactory<arenaPageViewCount>::Builder{ renderer, size, &currentPath }
+          .setAtlas(overlayAtlas)
+          .setCellSize(cellSize)
+          .setBoardSize(boardSize.w != 0u && boardSize.h != 0u ? boardSize : Size{ 512u, 512u })
+          .setSnakeCount(arenaSnakeCount)
+          .setSeed(seed)
+          .setRenderBackend(renderBackend)
+          .build();
+        return new SuspendableView{ renderer, arenaPageFactory->make(), [this]() {
+          return currentPath.get() == Path::ARENA;
+        } };
+      }, [this]() {
+        return arenaSnakeCount != 0u;
+      } }
+    };
+    // The app idles whenever nothing below is going on, see also ../Any/IdleMonitor.h for more details
+    idleMonitor.addActivity([this, gamePage, replayPage]() {
+      return !assetLoader->isIdle() || !gamePage->isBuilt() || !replayPage->isBuilt() ||
+        (gamePageFactory && gamePageFactory->isAnimating()) || (replayPageFactory && replayPageFactory->isAnimating()) ||
+        (arenaPageFactory && arenaPageFactory->isAnimating());
+    });
     return ViewGroup<viewCount>{ renderer, Point{ 0, 0 }, {
-      (mainPageFactory = MainPageFactory<mainPageViewCount>::Builder{ renderer, size, &currentPath, pointer }
-        .setHeadFont(headFont)
-        .setBodyFont(bodyFont)
-        .setButtonDuration(buttonDuration)
-        .setButtonPadding(buttonPadding)
-        .setCellSize(cellSize)
-        .build())
-        ->make(),
-      (gamePageFactory = GamePageFactory<gamePageViewCount>::Builder{ renderer, size, pointer, &currentPath }
-        .setHeadFont(headFont)
-        .setBodyFont(bodyFont)
-        .setButtonDuration(buttonDuration)
-        .setButtonPadding(buttonPadding)
-        .setCellSize(cellSize)
-        .build())
-        ->make()
+      new SessionRecorder{ renderer, sessionFilePath, seed },
+      new AssetUploadView{ renderer, assetLoader },
+      // The pages are the only views which animate
+      new IdleView{ renderer, &idleMonitor, buttonDuration << 1u, { mainPage, gamePage, replayPage, arenaPage } },
+      new StartupProbeView{ renderer, &startupTimeline }
     } };
   }
 
   ~SnakeViewGroupFactory() {
+    delete assetLoader;
+    delete arenaPageFactory;
+    delete replayPageFactory;
     delete gamePageFactory;
     delete mainPageFactory;
     SDL_FreeCursor(pointer);
-    TTF_CloseFont(bodyFont);
-    TTF_CloseFont(headFont);
+    delete overlayAtlas;
+    delete bodyAtlas;
+    delete headAtlas;
   }
 };
 
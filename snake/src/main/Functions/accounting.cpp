@@ -0,0 +1,167 @@
+// Copyright ii887522
+
+#include "accounting.h"
+#include <SDL.h>
+#include <ostream>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include "../Any/Enums.h"
+#include "../Struct/MemoryUsage.h"
+
+using std::ostream;
+using std::array;
+using std::atomic;
+using std::size_t;
+using std::malloc;
+using std::free;
+using std::get_new_handler;
+using std::bad_alloc;
+
+namespace ii887522::snake {
+
+// Blocks must stay aligned the same as operator new promises, which is more than max_align_t is aligned to on MSVC, and malloc()
+// already aligns blocks to it on 64-bit Windows
+static constexpr auto blockHeaderSize{ static_cast<size_t>(__STDCPP_DEFAULT_NEW_ALIGNMENT__) };
+static_assert(blockHeaderSize >= sizeof(size_t), "The size of a block must fit into its header!");
+
+static array<atomic<long long>, static_cast<unsigned int>(MemoryCategory::COUNT)> liveBytes{ };
+static array<atomic<long long>, static_cast<unsigned int>(MemoryCategory::COUNT)> liveBlockCounts{ };
+static atomic<unsigned long long> allocationCount{ 0ull };
+static atomic<long long> liveAllocationCount{ 0ll };
+static thread_local MemoryUsage threadMemoryUsage{ 0ll, 0ll };
+static SDL_malloc_func sdlMalloc{ nullptr };
+static SDL_calloc_func sdlCalloc{ nullptr };
+static SDL_realloc_func sdlRealloc{ nullptr };
+static SDL_free_func sdlFree{ nullptr };
+
+// Every block allocated through SDL or the global operator new starts with its size, so that it is known how much is freed
+static void* trackBlock(unsigned char*const block, const size_t size) {
+  if (!block) return nullptr;
+  *reinterpret_cast<size_t*>(block) = size;
+  threadMemoryUsage.bytes += size;
+  ++threadMemoryUsage.blockCount;
+  return block + blockHeaderSize;
+}
+
+// Param memory: it must have been returned by trackBlock()
+// Return: the block to free
+static unsigned char* untrackBlock(void*const memory) {
+  const auto block{ static_cast<unsigned char*>(memory) - blockHeaderSize };
+  threadMemoryUsage.bytes -= *reinterpret_cast<size_t*>(block);
+  --threadMemoryUsage.blockCount;
+  return block;
+}
+
+static void* SDLCALL trackedMalloc(const size_t size) {
+  return trackBlock(static_cast<unsigned char*>(sdlMalloc(size + blockHeaderSize)), size);
+}
+
+static void* SDLCALL trackedCalloc(const size_t count, const size_t size) {
+  return trackBlock(static_cast<unsigned char*>(sdlCalloc(1u, count * size + blockHeaderSize)), count * size);
+}
+
+static void* SDLCALL trackedRealloc(void*const memory, const size_t size) {
+  if (!memory) return trackedMalloc(size);
+  const auto prevBlock{ static_cast<unsigned char*>(memory) - blockHeaderSize };
+  const auto prevSize{ *reinterpret_cast<size_t*>(prevBlock) };
+  const auto block{ static_cast<unsigned char*>(sdlRealloc(prevBlock, size + blockHeaderSize)) };
+  if (!block) return nullptr;
+  *reinterpret_cast<size_t*>(block) = size;
+  threadMemoryUsage.bytes += static_cast<long long>(size) - static_cast<long long>(prevSize);
+  return block + blockHeaderSize;
+}
+
+static void SDLCALL trackedFree(void*const memory) {
+  if (!memory) return;
+  sdlFree(untrackBlock(memory));
+}
+
+// It stands for the global operator new, see also the end of the file
+static void* newTracked(const size_t size) {
+  for (;;) {
+    if (const auto block{ static_cast<unsigned char*>(malloc(size + blockHeaderSize)) }) {
+      ++allocationCount;
+      ++liveAllocationCount;
+      return trackBlock(block, size);
+    }
+    const auto newHandler{ get_new_handler() };
+    if (!newHandler) throw bad_alloc{ };
+    newHandler();
+  }
+}
+
+static void deleteTracked(void*const memory) {
+  if (!memory) return;
+  --liveAllocationCount;
+  free(untrackBlock(memory));
+}
+
+void startMemoryAccounting() {
+  SDL_GetMemoryFunctions(&sdlMalloc, &sdlCalloc, &sdlRealloc, &sdlFree);
+  SDL_SetMemoryFunctions(trackedMalloc, trackedCalloc, trackedRealloc, trackedFree);
+}
+
+unsigned long long getAllocationCount() {
+  return allocationCount;
+}
+
+long long getLiveAllocationCount() {
+  return liveAllocationCount;
+}
+
+MemoryUsage getThreadMemoryUsage() {
+  return threadMemoryUsage;
+}
+
+void trackAllocation(const MemoryCategory category, const MemoryUsage& usage) {
+  liveBytes[static_cast<unsigned int>(category)] += usage.bytes;
+  liveBlockCounts[static_cast<unsigned int>(category)] += usage.blockCount;
+}
+
+void trackFree(const MemoryCategory category, const MemoryUsage& usage) {
+  liveBytes[static_cast<unsigned int>(category)] -= usage.bytes;
+  liveBlockCounts[static_cast<unsigned int>(category)] -= usage.blockCount;
+}
+
+MemoryUsage getMemoryUsage(const MemoryCategory category) {
+  return MemoryUsage{ liveBytes[static_cast<unsigned int>(category)], liveBlockCounts[static_cast<unsigned int>(category)] };
+}
+
+MemoryUsage getTextureUsage(SDL_Texture*const texture) {
+  Uint32 format;
+  auto width{ 0 };
+  auto height{ 0 };
+  SDL_QueryTexture(texture, &format, nullptr, &width, &height);
+  return MemoryUsage{ static_cast<long long>(width) * height * SDL_BYTESPERPIXEL(format), 1ll };
+}
+
+MemoryUsage getSurfaceUsage(const SDL_Surface*const surface) {
+  return MemoryUsage{ static_cast<long long>(surface->h) * surface->pitch, 1ll };
+}
+
+void writeMemoryJson(ostream& stream) {
+  stream << "{ ";
+  for (auto i{ 0u }; i != static_cast<unsigned int>(MemoryCategory::COUNT); ++i) {
+    stream << (i == 0u ? "\"" : ", \"") << memoryCategoryNames[i] << "\": { \"bytes\": " << liveBytes[i] << ", \"blocks\": " <<
+      liveBlockCounts[i] << " }";
+  }
+  stream << " }";
+}
+
+}  // namespace ii887522::snake
+
+// The other forms of operator new and delete which are not over-aligned call these two by default
+void* operator new(const size_t size) {
+  return ii887522::snake::newTracked(size);
+}
+
+void operator delete(void*const memory) noexcept {
+  ii887522::snake::deleteTracked(memory);
+}
+
+void operator delete(void*const memory, const size_t) noexcept {
+  ii887522::snake::deleteTracked(memory);
+}
@@ -0,0 +1,63 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_FUNCTIONS_ACCOUNTING_H_
+#define SNAKE_SRC_MAIN_FUNCTIONS_ACCOUNTING_H_
+
+#include <SDL.h>
+#include <ostream>
+#include "../Any/Enums.h"
+#include "../Struct/MemoryUsage.h"
+
+using std::ostream;
+
+namespace ii887522::snake {
+
+// They are in the same order as MemoryCategory
+constexpr static const char* memoryCategoryNames[]{
+  "boardMap", "boardTextures", "snakeSegments", "reactiveWatchers", "textTextures", "fonts", "modalTrees"
+};
+
+// Memory accounting charges the memory alive to the subsystem which owns it, so that it is known which of them grows when the
+// board is scaled up or views are added instead of guessing from the memory of the whole process. Containers of the app charge
+// their memory through TrackingAllocator, textures and surfaces are charged by their owners when they are created and destroyed,
+// and the memory allocated inside libraries while building something is charged through MemoryScope. Everything allocated through
+// the global operator new, which is replaced, and through SDL, including SDL_ttf, is seen in every build. Memory allocated directly
+// through malloc() and over-aligned objects are not seen.
+// See also ../Any/TrackingAllocator.h and ../Any/MemoryScope.h for more details
+// Thread Safe
+
+// Hooks the memory functions of SDL. It must be called once before SDL allocates anything, which is before SDL is initialized.
+void startMemoryAccounting();
+
+// Return: the number of allocations made through the global operator new since the program started
+unsigned long long getAllocationCount();
+
+// Return: the number of blocks allocated minus the number of blocks freed through the global operator new since the program started
+long long getLiveAllocationCount();
+
+// Return: the memory allocated minus the memory freed by the calling thread through every heap seen, it only makes sense to
+//   compare it with itself at another time
+MemoryUsage getThreadMemoryUsage();
+
+void trackAllocation(const MemoryCategory, const MemoryUsage&);
+
+// Param usage: it must be the same as the one passed to trackAllocation() when the memory was allocated
+void trackFree(const MemoryCategory, const MemoryUsage& usage);
+
+// Return: the memory alive charged to the category given
+MemoryUsage getMemoryUsage(const MemoryCategory);
+
+// Param texture: it must not be assigned to integer
+// Return: the memory of the pixels of the texture given, which is 1 block
+MemoryUsage getTextureUsage(SDL_Texture*const texture);
+
+// Param surface: it must not be assigned to integer
+// Return: the memory of the pixels of the surface given, which is 1 block
+MemoryUsage getSurfaceUsage(const SDL_Surface*const surface);
+
+// Writes the memory alive charged to every category as a JSON object.
+void writeMemoryJson(ostream&);
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_FUNCTIONS_ACCOUNTING_H_
@@ -0,0 +1,32 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_FUNCTIONS_BUFFER_EXT_H_
+#define SNAKE_SRC_MAIN_FUNCTIONS_BUFFER_EXT_H_
+
+#include <vector>
+#include <type_traits>
+
+using std::vector;
+using std::is_unsigned_v;
+
+namespace ii887522::snake {
+
+// Appends the value given in little endian byte order, so the bytes are the same no matter which machine writes them.
+template <typename T> void writeLittleEndian(vector<char>*const buffer, const T value) {
+  static_assert(is_unsigned_v<T>, "Only unsigned integers can be written in little endian byte order!");
+  for (auto i{ 0u }; i != sizeof value; ++i) buffer->push_back(static_cast<char>(value >> (i << 3u)));
+}
+
+// Reads a value written by writeLittleEndian().
+// Param data: it must point to at least sizeof(T) bytes, it is advanced past them
+template <typename T> T readLittleEndian(const char** data) {
+  static_assert(is_unsigned_v<T>, "Only unsigned integers can be read in little endian byte order!");
+  T value{ 0u };
+  for (auto i{ 0u }; i != sizeof value; ++i) value |= static_cast<T>(static_cast<T>(static_cast<unsigned char>((*data)[i])) << (i << 3u));
+  *data += sizeof value;
+  return value;
+}
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_FUNCTIONS_BUFFER_EXT_H_
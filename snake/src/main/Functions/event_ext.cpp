@@ -0,0 +1,62 @@
+// Copyright ii887522
+
+#include "event_ext.h"
+#include <SDL.h>
+#include <atomic>
+
+using std::atomic;
+
+namespace ii887522::snake {
+
+// The number of motion events queued in a row since the last event of any other kind. SDL calls the filter with its filter lock
+// held, so it is never accessed by 2 threads at the same time.
+static auto motionRunLength{ 0 };
+
+// SDL may call the watch on whichever thread pushes the event
+static atomic<unsigned int> renderTargetResetCount{ 0u };
+static atomic<unsigned int> renderDeviceResetCount{ 0u };
+
+static int SDLCALL filterMouseMotion(void*, SDL_Event*const event) {
+  if (event->type != SDL_MOUSEMOTION) {
+    motionRunLength = 0;
+    return 1;
+  }
+  // Only the motion events of the latest run can be merged without moving them past another event. If more of them are queued,
+  // some come before another event still queued.
+  if (SDL_PeepEvents(nullptr, 0, SDL_PEEKEVENT, SDL_MOUSEMOTION, SDL_MOUSEMOTION) <= motionRunLength) {
+    SDL_Event queuedEvent;
+    while (SDL_PeepEvents(&queuedEvent, 1, SDL_GETEVENT, SDL_MOUSEMOTION, SDL_MOUSEMOTION) == 1) {
+      event->motion.xrel += queuedEvent.motion.xrel;
+      event->motion.yrel += queuedEvent.motion.yrel;
+    }
+    motionRunLength = 0;
+  }
+  ++motionRunLength;
+  return 1;
+}
+
+void coalesceMouseMotion() {
+  motionRunLength = 0;
+  SDL_SetEventFilter(filterMouseMotion, nullptr);
+}
+
+static int SDLCALL countRenderResets(void*, SDL_Event*const event) {
+  // A device reset loses the contents of render targets as well
+  if (event->type == SDL_RENDER_TARGETS_RESET || event->type == SDL_RENDER_DEVICE_RESET) ++renderTargetResetCount;
+  if (event->type == SDL_RENDER_DEVICE_RESET) ++renderDeviceResetCount;
+  return 1;
+}
+
+void watchRenderResets() {
+  SDL_AddEventWatch(countRenderResets, nullptr);
+}
+
+unsigned int getRenderTargetResetCount() {
+  return renderTargetResetCount;
+}
+
+unsigned int getRenderDeviceResetCount() {
+  return renderDeviceResetCount;
+}
+
+}  // namespace ii887522::snake
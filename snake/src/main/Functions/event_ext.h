@@ -0,0 +1,27 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_FUNCTIONS_EVENT_EXT_H_
+#define SNAKE_SRC_MAIN_FUNCTIONS_EVENT_EXT_H_
+
+namespace ii887522::snake {
+
+// Merges every mouse motion event queued into the one which comes after it, so that however fast the mouse reports its
+// movement, each frame reacts to at most 1 motion at its latest position with the relative motion of all of them summed. Motion
+// events queued before any other event are kept, so a click is still reacted to where the mouse was when it happened. It must be
+// called after SDL has been initialized, and it replaces any event filter set before.
+void coalesceMouseMotion();
+
+// Counts the render target and render device resets SDL reports, which happen when a Direct3D device is lost, e.g. on alt-tab or
+// a resolution change. A view which keeps a texture compares the counts against the ones it last saw before drawing with it.
+// It must be called after SDL has been initialized.
+void watchRenderResets();
+
+// Return: the number of times render targets have lost their contents since watchRenderResets() was called
+unsigned int getRenderTargetResetCount();
+
+// Return: the number of times every texture has been lost since watchRenderResets() was called
+unsigned int getRenderDeviceResetCount();
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_FUNCTIONS_EVENT_EXT_H_
@@ -3,27 +3,686 @@
 #ifndef TEST
 
 #include <Any/allocator.h>
+#include <winsock2.h>
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
 #include <SDL.h>
 #include <Any/Subsystems.h>
 #include <Any/App.h>
 #include <Struct/Size.h>
+#include <Struct/Point.h>
+#include <Struct/Rect.h>
 #include <Functions/control_flow.h>
 #include <Struct/Color.h>
+#include <string>
+#include <functional>
+#include <vector>
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <algorithm>
+#include <limits>
+#include <iostream>
+#include <fstream>
+#include <stdexcept>
+#include <filesystem>
+#include <system_error>
+#include <chrono>  // NOLINT(build/c++11)
+#include <thread>  // NOLINT(build/c++11)
 #include "../Factory/SnakeViewGroupFactory.h"
+#include "../Any/StartupTimeline.h"
+#include "../Any/SocketSubsystem.h"
+#include "../Any/ThreadPool.h"
+#include "../Any/GameServer.h"
+#include "../Any/BotClients.h"
+#include "../Any/StateReader.h"
+#include "../Any/ReplayReader.h"
+#include "../Any/VideoExporter.h"
+#include "../Any/TerminalRenderer.h"
+#include "../Any/RenderBenchmark.h"
+#include "../Any/SessionPlayer.h"
+#include "../Any/PerfBaseline.h"
+#include "../Any/SoakRunner.h"
+#include "../Any/Histogram.h"
+#include "../Any/Level.h"
+#include "../Any/LevelWriter.h"
+#include "../Any/MazeGenerator.h"
+#include "../Any/Enums.h"
+#include "../Struct/SharedState.h"
+#include "../Struct/SpawnPoint.h"
+#include "trace.h"
+#include "accounting.h"
+#include "event_ext.h"
+#include "time_ext.h"
+#include "random_ext.h"
 
 using ii887522::viewify::Subsystems;
 using ii887522::viewify::App;
 using ii887522::viewify::Size;
+using ii887522::viewify::Point;
+using ii887522::viewify::Rect;
 using ii887522::viewify::eventLoop;
 using ii887522::viewify::Color;
+using std::string;
+using std::to_string;
+using std::function;
+using std::vector;
+using std::array;
+using std::atomic;
+using std::snprintf;
+using std::min;
+using std::max;
+using std::numeric_limits;
+using std::getline;
+using std::cout;
+using std::cerr;
+using std::cin;
+using std::ostream;
+using std::ofstream;
+using std::ifstream;
+using std::ios;
+using std::runtime_error;
+using std::error_code;
+using std::chrono::high_resolution_clock;
+using std::chrono::milliseconds;
+using std::chrono::duration_cast;
+using std::filesystem::create_directories;
+using std::filesystem::path;
+using std::this_thread::sleep_for;
 
 namespace ii887522::snake {
 
-static int main(int, char**) {
+constexpr static Size windowSize{ 752, 752 };
+constexpr static auto maxArenaSnakeCount{ 1000000u };  // an arena of more snakes steps too slowly to be watched
+constexpr static auto maxPort{ 65535u };
+constexpr static auto maxBotCount{ 16384u };  // Windows only has that many ephemeral ports for bots to connect from by default
+constexpr static auto maxMadeLevelCount{ 1000000u };  // a directory of more files is slow to browse
+
+// Param value: a number in decimal digits
+// Param name: what the number is, used to report it
+// Param result: the number is stored into it if it is between minValue and maxValue, otherwise the reason is written into the
+//   standard error
+// Return: whether the value is valid
+template <typename T> static bool parseNumber(const string& value, const char*const name, const T minValue, const T maxValue,
+  T*const result) {
+  auto number{ static_cast<T>(0u) };
+  auto isValid{ !value.empty() };
+  for (const auto digit : value) {
+    const auto digitValue{ static_cast<T>(digit - '0') };
+    // Stopping before the number goes beyond maxValue keeps it from overflowing
+    if (digit < '0' || digit > '9' || number > maxValue / 10u || number * 10u > maxValue - digitValue) {
+      isValid = false;
+      break;
+    }
+    number = number * 10u + digitValue;
+  }
+  if (!isValid || number < minValue) {
+    cerr << "Invalid " << name << ' ' << value << ", it must be a number between " << minValue << " and " << maxValue << '\n';
+    return false;
+  }
+  *result = number;
+  return true;
+}
+
+// Param value: the number of cells on a side of a board in decimal digits
+// Return: the number of cells, or 0 if it is not a number between 4 and maxBoardSide
+static unsigned int parseBoardSide(const string& value) {
+  // Longer numbers are out of range anyway, and stopping there keeps the result from overflowing
+  if (value.empty() || value.size() > to_string(maxBoardSide).size()) return 0u;
+  auto result{ 0u };
+  for (const auto digit : value) {
+    if (digit < '0' || digit > '9') return 0u;
+    result = result * 10u + static_cast<unsigned int>(digit - '0');
+  }
+  return result >= 4u && result <= maxBoardSide ? result : 0u;
+}
+
+// Param value: it must be in the form of WIDTHxHEIGHT, e.g. 1000x1000, and each side must be between 4 and maxBoardSide
+// Param result: the size parsed is stored into it if the value is valid, otherwise the reason is written into the standard error
+// Return: whether the value is valid
+static bool parseSize(const string& value, Size<unsigned int>*const result) {
+  const auto separatorIndex{ value.find('x') };
+  const auto width{ separatorIndex == string::npos ? 0u : parseBoardSide(value.substr(0u, separatorIndex)) };
+  const auto height{ separatorIndex == string::npos ? 0u : parseBoardSide(value.substr(separatorIndex + 1u)) };
+  if (width == 0u || height == 0u) {
+    cerr << "Invalid board size " << value << ", it must be WIDTHxHEIGHT with each side between 4 and " << maxBoardSide << '\n';
+    return false;
+  }
+  *result = Size{ width, height };
+  return true;
+}
+
+// Opens the level file given for as long as the game may be played on it.
+// Return: the level, or nullptr if it cannot be played on, in which case the reason is written into the standard error
+static const Level* loadLevel(const string& filePath) {
+  try {
+    const auto result{ new Level{ filePath } };
+    const auto& boardSize{ result->getBoardSize() };
+    if (boardSize.w >= 4u && boardSize.h >= 4u && boardSize.w <= maxBoardSide && boardSize.h <= maxBoardSide) return result;
+    cerr << "Invalid level " << filePath << ", each side of its board must be between 4 and " << maxBoardSide << '\n';
+    delete result;
+  } catch (const runtime_error& error) {
+    cerr << "Failed to load " << filePath << ": " << error.what() << '\n';
+  }
+  return nullptr;
+}
+
+static unsigned long long getSeed() {
+  return static_cast<unsigned long long>(high_resolution_clock::now().time_since_epoch().count());
+}
+
+// Release builds use the Windows subsystem, so they start without a console and their standard streams go nowhere. It attaches
+// the console the app was started from, so that its output and Ctrl+C reach the app. Streams redirected into files or pipes are
+// left alone.
+// Param isAllocating: whether to open a new console if the app was not started from one
+static void attachConsole(const bool isAllocating) {
+  if (GetConsoleWindow()) return;
+  if (!AttachConsole(ATTACH_PARENT_PROCESS) && !(isAllocating && AllocConsole())) return;
+  FILE* stream;
+  if (_fileno(stdin) < 0) freopen_s(&stream, "CONIN$", "r", stdin);
+  if (_fileno(stdout) < 0) freopen_s(&stream, "CONOUT$", "w", stdout);
+  if (_fileno(stderr) < 0) freopen_s(&stream, "CONOUT$", "w", stderr);
+  cin.clear();
+  cout.clear();
+  cerr.clear();
+}
+
+static function<void()> stopHeadless;  // it stops whatever runs without a window
+
+static BOOL WINAPI reactConsoleControl(const DWORD) {
+  if (stopHeadless) stopHeadless();
+  return TRUE;
+}
+
+// Runs a game server without any window until the console is interrupted.
+// See also ../Any/GameServer.h for more details
+// Return: whether the server has started, otherwise the reason is written into the standard error
+static bool serve(const unsigned short port, const Size<unsigned int>& boardSize) {
+  try {
+    const SocketSubsystem socketSubsystem;
+    ThreadPool threadPool;
+    GameServer gameServer{ port, boardSize, threadPool, getSeed() };
+    stopHeadless = [&gameServer]() { gameServer.stop(); };
+    SetConsoleCtrlHandler(reactConsoleControl, TRUE);
+    gameServer.run();
+    stopHeadless = nullptr;
+  } catch (const runtime_error& error) {
+    cerr << "Failed to serve on port " << port << ": " << error.what() << '\n';
+    return false;
+  }
+  return true;
+}
+
+// Plays games on a game server running on this machine until the console is interrupted.
+// See also ../Any/BotClients.h for more details
+// Return: whether every bot has connected, otherwise the reason is written into the standard error
+static bool playBots(const unsigned short port, const unsigned int count) {
+  try {
+    const SocketSubsystem socketSubsystem;
+    BotClients botClients{ port, count, getSeed() };
+    stopHeadless = [&botClients]() { botClients.stop(); };
+    SetConsoleCtrlHandler(reactConsoleControl, TRUE);
+    botClients.run();
+    stopHeadless = nullptr;
+  } catch (const runtime_error& error) {
+    cerr << "Failed to play on port " << port << ": " << error.what() << '\n';
+    return false;
+  }
+  return true;
+}
+
+// Return: the position of the first of the count cells shown along a side of the board so that the cell given is in the middle
+//   of them if possible
+static unsigned int getViewOrigin(const unsigned int position, const unsigned int count, const unsigned int boardSide) {
+  return min(position - min(position, count >> 1u), boardSide - count);
+}
+
+// Draws the game read in the terminal whenever it changes until the console is interrupted.
+// See also ../Any/TerminalRenderer.h for more details
+static void observe(const StateReader& stateReader) {
+  constexpr auto statusCapacity{ 128u };
+  // The terminal only understands escape sequences once they are enabled
+  const auto console{ GetStdHandle(STD_OUTPUT_HANDLE) };
+  DWORD consoleMode{ 0u };
+  GetConsoleMode(console, &consoleMode);
+  SetConsoleMode(console, consoleMode | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
+  Size terminalSize{ 80u, 24u };
+  CONSOLE_SCREEN_BUFFER_INFO consoleInfo;
+  if (GetConsoleScreenBufferInfo(console, &consoleInfo)) {
+    terminalSize = Size{
+      static_cast<unsigned int>(consoleInfo.srWindow.Right - consoleInfo.srWindow.Left + 1),
+      static_cast<unsigned int>(consoleInfo.srWindow.Bottom - consoleInfo.srWindow.Top + 1)
+    };
+  }
+  atomic isObserving{ true };
+  stopHeadless = [&isObserving]() { isObserving = false; };
+  SetConsoleCtrlHandler(reactConsoleControl, TRUE);
+  {
+    const auto& boardSize{ stateReader.getBoardSize() };
+    // The last line of the terminal shows the status
+    TerminalRenderer terminalRenderer{ cout, Size{ min(boardSize.w, terminalSize.w >> 1u), min(boardSize.h, terminalSize.h - 1u) } };
+    const auto& viewSize{ terminalRenderer.getSize() };
+    auto publishCount{ 0ull };
+    SharedState state;
+    vector<unsigned char> cells;
+    char status[statusCapacity];
+    while (isObserving) {
+      sleep_for(milliseconds{ 16 });
+      if (stateReader.getPublishCount() == publishCount) continue;
+      publishCount = stateReader.getPublishCount();
+      if (!stateReader.read(&state, &cells)) continue;
+      // The view follows the head if the board does not fit into the terminal
+      const Point viewOrigin{
+        getViewOrigin(state.head.x, viewSize.w, boardSize.w), getViewOrigin(state.head.y, viewSize.h, boardSize.h)
+      };
+      for (auto y{ 0u }; y != viewSize.h; ++y) {
+        for (auto x{ 0u }; x != viewSize.w; ++x)
+          terminalRenderer.set(Point{ x, y }, stateReader.getCell(cells, viewOrigin + Point{ x, y }));
+      }
+      snprintf(status, statusCapacity, "tick %u  score %u  length %u%s", state.tick, state.score, state.length,
+        state.isDead ? "  dead" : "");
+      terminalRenderer.setStatus(status);
+      terminalRenderer.present();
+    }
+  }
+  stopHeadless = nullptr;
+  SetConsoleMode(console, consoleMode);
+}
+
+// Draws a game published under the shared memory name given in the terminal whenever it changes until the console is interrupted.
+// See also ../Any/StatePublisher.h for more details
+// Return: whether the game has been found, otherwise the reason is written into the standard error
+static bool observe(const string& name) {
+  try {
+    observe(StateReader{ name });
+  } catch (const runtime_error& error) {
+    cerr << "Failed to observe " << name << ": " << error.what() << '\n';
+    return false;
+  }
+  return true;
+}
+
+// Writes the replay given as a video without any window.
+// Param replayFilePath: the path of the replay file, or latest for the replay most recently recorded
+// Param outputPath: the path of the video file, or - for the standard output. It is a PPM stream if it ends with .ppm, otherwise
+//   it is Y4M. See also ../Any/VideoExporter.h for more details
+// Return: whether every frame has been written, otherwise the reason is written into the standard error
+static bool exportVideo(const string& replayFilePath, const string& outputPath) {
+  constexpr auto cellSize{ 16 };
+  const auto l_replayFilePath{ replayFilePath == "latest" ? ReplayReader::getLatestFilePath("replays/") : replayFilePath };
+  if (l_replayFilePath.empty()) {
+    cerr << "No replay found in replays/\n";
+    return false;
+  }
+  ofstream file;
+  if (outputPath == "-") _setmode(_fileno(stdout), _O_BINARY);
+  else file.open(outputPath, ios::binary | ios::trunc);
+  if (outputPath != "-" && !file) {
+    cerr << "Failed to open " << outputPath << '\n';
+    return false;
+  }
+  ostream& output{ outputPath == "-" ? cout : file };
+  try {
+    VideoExporter{ l_replayFilePath, cellSize, outputPath.ends_with(".ppm") ? VideoFormat::PPM : VideoFormat::Y4M, output }.run();
+  } catch (const runtime_error& error) {
+    cerr << "Failed to export " << l_replayFilePath << ": " << error.what() << '\n';
+    return false;
+  }
+  output.flush();
+  return static_cast<bool>(output);
+}
+
+// Times frames of the game page drawn offscreen in scripted scenarios without any window and writes the results as JSON into the
+// standard output. See also ../Any/RenderBenchmark.h for more details
+static void benchmarkRender(const RenderBackend renderBackend) {
+  // No window is ever shown, so it runs on machines without a display as well
+  SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+  const Subsystems subsystems;
+  RenderBenchmark{ windowSize, renderBackend }.run(cout);
+}
+
+// Plays the session given through the whole app a few times without any window and compares how long each phase of a frame takes
+// against the baseline given. See also ../Any/SessionPlayer.h and ../Any/PerfBaseline.h for more details
+// Param baselineFilePath: if the file does not exist, the results are written into it as the baseline instead
+// Return: whether no phase has regressed, or false if the session cannot be played, in which case the reason is written into the
+//   standard error
+static bool playSession(const string& sessionFilePath, const string& baselineFilePath, const RenderBackend renderBackend) {
+  constexpr auto runCount{ 5u };
+  constexpr const char* phaseNames[]{ "input", "step", "checkAndReactHits", "render" };
+  SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+  const Subsystems subsystems;
+  PerfBaseline perfBaseline;
+  try {
+    SessionPlayer sessionPlayer{ sessionFilePath, windowSize, renderBackend };
+    for (auto i{ 0u }; i != runCount; ++i) {
+      array<Histogram, static_cast<unsigned int>(Phase::COUNT)> histograms;
+      sessionPlayer.play(&histograms);
+      for (auto j{ 0u }; j != static_cast<unsigned int>(Phase::COUNT); ++j) {
+        perfBaseline.add(string{ phaseNames[j] } + ".meanUs", static_cast<double>(histograms[j].getMean()));
+        perfBaseline.add(string{ phaseNames[j] } + ".p99Us", static_cast<double>(histograms[j].getPercentile(99.)));
+      }
+    }
+  } catch (const runtime_error& error) {
+    cerr << "Failed to play " << sessionFilePath << ": " << error.what() << '\n';
+    return false;
+  }
+  ifstream baselineFile{ baselineFilePath };
+  if (!baselineFile) {
+    ofstream newBaselineFile{ baselineFilePath };
+    perfBaseline.write(newBaselineFile);
+    cout << "Baseline written into " << baselineFilePath << '\n';
+    return static_cast<bool>(newBaselineFile);
+  }
+  return perfBaseline.compare(baselineFile, cout) == 0u;
+}
+
+// Plays games back to back on the game page drawn offscreen without any window until the number of games given has been played
+// or the console is interrupted, and writes the metrics sampled along the way into the standard output.
+// See also ../Any/SoakRunner.h for more details
+// Return: whether no metric keeps going up
+static bool soak(const unsigned long long gameCount, const SoakInput input, const RenderBackend renderBackend) {
+  SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+  const Subsystems subsystems;
+  SoakRunner soakRunner{ windowSize, renderBackend, input, gameCount, getSeed() };
+  stopHeadless = [&soakRunner]() { soakRunner.stop(); };
+  SetConsoleCtrlHandler(reactConsoleControl, TRUE);
+  const auto growingCount{ soakRunner.run(cout) };
+  stopHeadless = nullptr;
+  return growingCount == 0u;
+}
+
+// Writes the text layout given as a level file. Each line of the layout is a row of the board including the border, which is
+// always walls. '#' is a wall, '^', '>', 'v' and '<' are cells a new snake may be born in heading up, right, down and left
+// respectively and 'f' is a cell food may spawn in. Any other character is an empty cell, and short lines are padded with them.
+// Neither snakes nor food may be placed on the border.
+// See also ../Any/LevelWriter.h for more details
+// Return: whether the level file has been written
+static bool makeLevel(const string& layoutFilePath, const string& outputPath) {
+  ifstream layoutFile{ layoutFilePath };
+  if (!layoutFile) return false;
+  vector<string> rows;
+  auto width{ 0u };
+  for (string row; getline(layoutFile, row);) {
+    if (!row.empty() && row.back() == '\r') row.pop_back();
+    width = max(static_cast<unsigned int>(row.size()), width);
+    rows.push_back(row);
+  }
+  if (width < 4u || rows.size() < 4u) return false;
+  LevelWriter levelWriter{ Size{ width, static_cast<unsigned int>(rows.size()) } };
+  // Runs of food cells of the same columns in consecutive rows are merged into a single zone
+  vector<Rect<unsigned int>> foodZones;
+  for (auto y{ 0u }; y != rows.size(); ++y) {
+    for (auto x{ 0u }; x != width; ++x) {
+      const auto cell{ x < rows[y].size() ? rows[y][x] : ' ' };
+      const Point position{ x, y };
+      const auto isBorder{ x == 0u || y == 0u || x == width - 1u || y == rows.size() - 1u };
+      if (isBorder && (cell == '^' || cell == '>' || cell == 'v' || cell == '<' || cell == 'f')) {
+        cerr << "Invalid cell " << cell << " at " << x << ',' << y << " in " << layoutFilePath << ", it is on the border\n";
+        return false;
+      }
+      if (cell == '#') levelWriter.setWall(position);
+      else if (cell == '^') levelWriter.addSpawnPoint(SpawnPoint{ position, Direction::UP });
+      else if (cell == '>') levelWriter.addSpawnPoint(SpawnPoint{ position, Direction::RIGHT });
+      else if (cell == 'v') levelWriter.addSpawnPoint(SpawnPoint{ position, Direction::DOWN });
+      else if (cell == '<') levelWriter.addSpawnPoint(SpawnPoint{ position, Direction::LEFT });
+      if (cell != 'f') continue;
+      const auto begin{ x };
+      while (x + 1u < rows[y].size() && rows[y][x + 1u] == 'f') ++x;
+      const Rect run{ Point{ begin, y }, Size{ x - begin + 1u, 1u } };
+      auto isMerged{ false };
+      for (auto& foodZone : foodZones) {
+        if (foodZone.position.x != run.position.x || foodZone.size.w != run.size.w || foodZone.position.y + foodZone.size.h != y) {
+          continue;
+        }
+        ++foodZone.size.h;
+        isMerged = true;
+        break;
+      }
+      if (!isMerged) foodZones.push_back(run);
+    }
+  }
+  for (const auto& foodZone : foodZones) levelWriter.addFoodZone(foodZone);
+  return levelWriter.write(outputPath);
+}
+
+// Generates layouts on every hardware thread and writes each of them which passes validation as a level file named after its
+// seed, so that the same level can be generated again. See also ../Any/MazeGenerator.h for more details
+// Param boardSize: each side must be between the corridor width plus 2 and maxBoardSide, otherwise nothing is generated and the
+//   reason is written into the standard error
+// Param dirPath: the directory the level files are written into, which is created if it does not exist
+// Return: whether every level file has been written, otherwise the reason is written into the standard error if the directory
+//   cannot be created
+static bool makeLevels(const unsigned int count, const Size<unsigned int>& boardSize, const string& dirPath) {
+  constexpr auto corridorWidth{ 2u };  // a snake can only turn back on itself in a corridor at least 2 cells wide
+  constexpr auto snakeLength{ 64u };  // the length a daily challenge expects the snake to grow to
+  constexpr auto wallRatio{ .2f };
+  constexpr auto attemptCount{ 8u };  // the number of layouts generated for each level before giving up
+  static_assert((maxBoardSide + 1ull) * (maxBoardSide + 1ull) <= numeric_limits<unsigned int>::max(),
+    "The cells of the largest board must be countable by MazeGenerator!");
+  if (
+    boardSize.w < corridorWidth + 2u || boardSize.h < corridorWidth + 2u || boardSize.w > maxBoardSide ||
+    boardSize.h > maxBoardSide
+  ) {
+    cerr << "Invalid board size " << boardSize.w << 'x' << boardSize.h << ", each side must be between " << corridorWidth + 2u <<
+      " and " << maxBoardSide << '\n';
+    return false;
+  }
+  error_code errorCode;
+  create_directories(dirPath, errorCode);
+  if (errorCode) {
+    cerr << "Failed to create " << dirPath << ": " << errorCode.message() << '\n';
+    return false;
+  }
+  const auto beginTime{ high_resolution_clock::now() };
+  const auto baseSeed{ getSeed() };
+  atomic<unsigned int> writtenCount{ 0u };
+  ThreadPool threadPool;
+  threadPool.parallelFor(count, [boardSize, &dirPath, baseSeed, &writtenCount](const unsigned int begin, const unsigned int end) {
+    // Each range reuses 1 generator so that its buffers are only allocated once
+    MazeGenerator mazeGenerator{ boardSize, corridorWidth, snakeLength };
+    for (auto i{ begin }; i != end; ++i) {
+      auto randomState{ baseSeed + i };
+      for (auto j{ 0u }; j != attemptCount; ++j) {
+        const auto seed{ nextRandom(&randomState) };
+        mazeGenerator.generate(seed, wallRatio);
+        if (!mazeGenerator.validate()) continue;
+        LevelWriter levelWriter{ boardSize };
+        mazeGenerator.write(&levelWriter);
+        if (levelWriter.write((path{ dirPath } / (to_string(seed) + ".level")).string())) ++writtenCount;
+        break;
+      }
+    }
+  });
+  cout << writtenCount << " of " << count << " levels written into " << dirPath << " in " <<
+    duration_cast<milliseconds>(high_resolution_clock::now() - beginTime).count() << " ms\n";
+  return writtenCount == count;
+}
+
+// Param argv: pass --trace to record a timeline trace from startup until exit. See also trace.h for more details
+//   Pass --board WIDTHxHEIGHT to play on a board of that many cells, which may be larger than the window.
+//   Pass --arena SNAKE_COUNT to watch that many bots play in an arena, see also ../Model/Arena.h for more details
+//   Pass --server PORT to host games for clients over TCP without any window, see also ../Any/GameServer.h for more details
+//   Pass --bots PORT COUNT to play that many games at once on a server running on this machine without any window
+//   Pass --publish NAME to publish the state of the game played into shared memory on every tick, see also
+//   ../Any/StatePublisher.h for more details
+//   Pass --observe NAME to watch a game published by another instance in the terminal without any window
+//   Pass --export REPLAY OUTPUT to write a replay as a video without any window, see also exportVideo() for more details
+//   Pass --software to draw with the CPU only, for machines without a usable GPU. See also ../View/BoardView.h for more details
+//   Pass --record-session to record every input and frame into a new session file in sessions/, see also
+//   ../View/SessionRecorder.h for more details
+//   Pass --play-session SESSION BASELINE to check a recorded session for performance regressions without any window, see also
+//   playSession() for more details
+//   Pass --soak GAMES to play that many games back to back without any window and check that no memory leaks, see also soak()
+//   for more details. Pass --autopilot as well to steer the snakes along the whole board instead of turning them at random.
+//   Pass --bench-render to time frames of the game page in scripted scenarios without any window, see also benchmarkRender() for
+//   more details
+//   Pass --level LEVEL to play on the walls, spawn points and food zones of a level file, see also ../Any/Level.h for more details
+//   Pass --make-level LAYOUT OUTPUT to write a text layout as a level file without any window, see also makeLevel() for more
+//   details
+//   Pass --make-levels COUNT WIDTHxHEIGHT DIR to generate that many validated levels into a directory without any window, see
+//   also makeLevels() for more details
+static int main(int argc, char** argv) {
+  // SDL must allocate everything through the accounting, see also accounting.h for more details
+  startMemoryAccounting();
+  // Errors in the arguments are reported into the console the app was started from if any
+  if (argc > 1) attachConsole(false);
+  Size boardSize{ 0u, 0u };
+  auto arenaSnakeCount{ 0u };
+  auto serverPort{ 0u };
+  auto botPort{ 0u };
+  auto botCount{ 0u };
+  string stateName;
+  string observedStateName;
+  string exportedReplayFilePath;
+  string videoPath;
+  auto renderBackend{ RenderBackend::RENDERER };
+  auto isBenchmarkingRender{ false };
+  string sessionFilePath;
+  string playedSessionFilePath;
+  string baselineFilePath;
+  auto soakGameCount{ 0ull };
+  auto soakInput{ SoakInput::RANDOM };
+  string levelFilePath;
+  string layoutFilePath;
+  string madeLevelFilePath;
+  auto madeLevelCount{ 0u };
+  string madeLevelDirPath;
+  for (auto i{ 1 }; i < argc; ++i) {
+    if (string{ argv[i] } == "--trace") startTracing("stats/" + getTimestamp() + ".trace.json");
+    else if (string{ argv[i] } == "--board" && i + 1 < argc) {
+      if (parseSize(argv[++i], &boardSize)) continue;
+      stopTracing();
+      return EXIT_FAILURE;
+    } else if (string{ argv[i] } == "--arena" && i + 1 < argc) {
+      if (parseNumber(argv[++i], "arena snake count", 1u, maxArenaSnakeCount, &arenaSnakeCount)) continue;
+      stopTracing();
+      return EXIT_FAILURE;
+    } else if (string{ argv[i] } == "--server" && i + 1 < argc) {
+      if (parseNumber(argv[++i], "port", 1u, maxPort, &serverPort)) continue;
+      stopTracing();
+      return EXIT_FAILURE;
+    } else if (string{ argv[i] } == "--bots" && i + 2 < argc) {
+      const auto isPortValid{ parseNumber(argv[++i], "port", 1u, maxPort, &botPort) };
+      if (isPortValid && parseNumber(argv[++i], "bot count", 1u, maxBotCount, &botCount)) continue;
+      stopTracing();
+      return EXIT_FAILURE;
+    } else if (string{ argv[i] } == "--publish" && i + 1 < argc) {
+      stateName = string{ "Local\\" } + argv[++i];
+    } else if (string{ argv[i] } == "--observe" && i + 1 < argc) {
+      observedStateName = string{ "Local\\" } + argv[++i];
+    } else if (string{ argv[i] } == "--export" && i + 2 < argc) {
+      exportedReplayFilePath = argv[++i];
+      videoPath = argv[++i];
+    } else if (string{ argv[i] } == "--software") {
+      renderBackend = RenderBackend::SOFTWARE;
+    } else if (string{ argv[i] } == "--bench-render") {
+      isBenchmarkingRender = true;
+    } else if (string{ argv[i] } == "--record-session") {
+      sessionFilePath = "sessions/" + getTimestamp() + ".session";
+    } else if (string{ argv[i] } == "--play-session" && i + 2 < argc) {
+      playedSessionFilePath = argv[++i];
+      baselineFilePath = argv[++i];
+    } else if (string{ argv[i] } == "--soak" && i + 1 < argc) {
+      if (parseNumber(argv[++i], "game count", 1ull, numeric_limits<unsigned long long>::max(), &soakGameCount)) continue;
+      stopTracing();
+      return EXIT_FAILURE;
+    } else if (string{ argv[i] } == "--autopilot") {
+      soakInput = SoakInput::AUTOPILOT;
+    } else if (string{ argv[i] } == "--level" && i + 1 < argc) {
+      levelFilePath = argv[++i];
+    } else if (string{ argv[i] } == "--make-level" && i + 2 < argc) {
+      layoutFilePath = argv[++i];
+      madeLevelFilePath = argv[++i];
+    } else if (string{ argv[i] } == "--make-levels" && i + 3 < argc) {
+      const auto isCountValid{ parseNumber(argv[++i], "level count", 1u, maxMadeLevelCount, &madeLevelCount) };
+      const auto isSizeValid{ parseSize(argv[++i], &boardSize) };
+      madeLevelDirPath = argv[++i];
+      if (isCountValid && isSizeValid) continue;
+      stopTracing();
+      return EXIT_FAILURE;
+    }
+  }
+  // Every mode below runs without a window and talks through the console, which is opened if there is none
+  if (
+    serverPort != 0u || !exportedReplayFilePath.empty() || !layoutFilePath.empty() || madeLevelCount != 0u ||
+    !observedStateName.empty() || !playedSessionFilePath.empty() || soakGameCount != 0ull || isBenchmarkingRender || botPort != 0u
+  ) {
+    attachConsole(true);
+  }
+  if (serverPort != 0u) {
+    // The board fits the window by default, the same as in the game page
+    const auto hasServed{
+      serve(static_cast<unsigned short>(serverPort), boardSize.w != 0u && boardSize.h != 0u ? boardSize : Size{ 47u, 43u })
+    };
+    stopTracing();
+    return hasServed ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+  if (!exportedReplayFilePath.empty()) {
+    const auto isExported{ exportVideo(exportedReplayFilePath, videoPath) };
+    stopTracing();
+    return isExported ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+  if (!layoutFilePath.empty()) {
+    const auto isMade{ makeLevel(layoutFilePath, madeLevelFilePath) };
+    stopTracing();
+    return isMade ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+  if (madeLevelCount != 0u) {
+    const auto isMade{ makeLevels(madeLevelCount, boardSize, madeLevelDirPath) };
+    stopTracing();
+    return isMade ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+  if (!observedStateName.empty()) {
+    const auto hasObserved{ observe(observedStateName) };
+    stopTracing();
+    return hasObserved ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+  if (!playedSessionFilePath.empty()) {
+    const auto hasPassed{ playSession(playedSessionFilePath, baselineFilePath, renderBackend) };
+    stopTracing();
+    return hasPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+  if (soakGameCount != 0ull) {
+    const auto hasPassed{ soak(soakGameCount, soakInput, renderBackend) };
+    stopTracing();
+    return hasPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+  if (isBenchmarkingRender) {
+    benchmarkRender(renderBackend);
+    stopTracing();
+    return EXIT_SUCCESS;
+  }
+  if (botPort != 0u) {
+    const auto hasPlayed{ playBots(static_cast<unsigned short>(botPort), botCount) };
+    stopTracing();
+    return hasPlayed ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+  // The level is mapped into memory for as long as the game may be played on it
+  const auto level{ levelFilePath.empty() ? nullptr : loadLevel(levelFilePath) };
+  if (!levelFilePath.empty() && !level) {
+    stopTracing();
+    return EXIT_FAILURE;
+  }
+  StartupTimeline startupTimeline{ "stats/" };
   const Subsystems subsystems;
-  constexpr auto viewCount{ 2u };
-  SnakeViewGroupFactory<viewCount> snakeViewGroupFactory;
-  eventLoop(App<viewCount>{ "Snake", Size{ 752, 752 }, Color{ 0u, 0u, 0u }, &snakeViewGroupFactory });
+  startupTimeline.mark("subsystems");
+  // High polling rate mice would otherwise make every view react to hundreds of motions per frame
+  coalesceMouseMotion();
+  // Textures kept across frames must be redrawn or recreated once the Direct3D device is lost
+  watchRenderResets();
+  // The renderer draws into the window surface without probing any GPU driver, while the boards skip the renderer altogether
+  if (renderBackend == RenderBackend::SOFTWARE) SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+  // SDL only batches draw calls by itself when no render driver is asked for, and every glyph drawn from an atlas is a copy of
+  // its own before SDL 2.0.18, see also ../Any/GlyphAtlas.h for more details
+  SDL_SetHint(SDL_HINT_RENDER_BATCHING, "1");
+  SnakeViewGroupFactory<appViewCount> snakeViewGroupFactory{
+    &startupTimeline, boardSize, arenaSnakeCount, stateName, renderBackend, getSeed(), sessionFilePath, level
+  };
+  startupTimeline.mark("viewGroupFactory");
+  eventLoop(App<appViewCount>{ "Snake", windowSize, Color{ 0u, 0u, 0u }, &snakeViewGroupFactory });
+  delete level;
+  stopTracing();
   return EXIT_SUCCESS;
 }
 
@@ -0,0 +1,30 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_FUNCTIONS_PROCESS_EXT_H_
+#define SNAKE_SRC_MAIN_FUNCTIONS_PROCESS_EXT_H_
+
+#include <windows.h>
+#include <psapi.h>
+
+namespace ii887522::snake {
+
+// Return: the number of bytes of this process which are resident in physical memory
+inline unsigned long long getResidentSetSize() {
+  PROCESS_MEMORY_COUNTERS_EX counters{ };
+  counters.cb = sizeof counters;
+  GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&counters), sizeof counters);
+  return counters.WorkingSetSize;
+}
+
+// Return: the number of bytes this process has committed for itself, it keeps going up if memory leaks even when the leaked
+//   pages are swapped out
+inline unsigned long long getPrivateBytes() {
+  PROCESS_MEMORY_COUNTERS_EX counters{ };
+  counters.cb = sizeof counters;
+  GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&counters), sizeof counters);
+  return counters.PrivateUsage;
+}
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_FUNCTIONS_PROCESS_EXT_H_
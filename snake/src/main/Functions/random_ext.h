@@ -0,0 +1,27 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_FUNCTIONS_RANDOM_EXT_H_
+#define SNAKE_SRC_MAIN_FUNCTIONS_RANDOM_EXT_H_
+
+namespace ii887522::snake {
+
+// It is SplitMix64. Unlike the generators in <random>, its whole state is 1 integer and every seed gives an independent stream,
+// so many small generators can be seeded from 1 seed and give the same numbers on every platform.
+// Param state: it is advanced
+// Return: the next random number
+constexpr unsigned long long nextRandom(unsigned long long*const state) {
+  auto result{ *state += 0x9e3779b97f4a7c15ull };
+  result = (result ^ (result >> 30u)) * 0xbf58476d1ce4e5b9ull;
+  result = (result ^ (result >> 27u)) * 0x94d049bb133111ebull;
+  return result ^ (result >> 31u);
+}
+
+// Param state: it is advanced
+// Return: a random number in [0, count)
+constexpr unsigned int nextRandom(unsigned long long*const state, const unsigned int count) {
+  return static_cast<unsigned int>(nextRandom(state) % count);
+}
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_FUNCTIONS_RANDOM_EXT_H_
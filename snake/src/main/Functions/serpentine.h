@@ -0,0 +1,37 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_FUNCTIONS_SERPENTINE_H_
+#define SNAKE_SRC_MAIN_FUNCTIONS_SERPENTINE_H_
+
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include "../Any/Enums.h"
+
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+// The serpentine of a board visits every cell inside the walls once. It starts from the top left corner and goes back and forth
+// along the rows, moving down 1 row at the end of each of them.
+
+// Param boardSize: the number of cells on each side of the board including the walls
+// Param index: it must be less than the number of cells inside the walls
+// Return: the position of the cell visited at the index given
+constexpr Point<unsigned int> getSerpentinePosition(const Size<unsigned int>& boardSize, const unsigned int index) {
+  const auto width{ boardSize.w - 2u };
+  const auto row{ index / width };
+  return Point{ 1u + ((row & 1u) ? width - 1u - index % width : index % width), 1u + row };
+}
+
+// Param boardSize: the number of cells on each side of the board including the walls
+// Param index: it must be less than the number of cells inside the walls minus 1
+// Return: the way from the cell visited at the index given to the next one
+constexpr Direction getSerpentineDirection(const Size<unsigned int>& boardSize, const unsigned int index) {
+  const auto width{ boardSize.w - 2u };
+  return index % width == width - 1u ? Direction::DOWN : ((index / width) & 1u) ? Direction::LEFT : Direction::RIGHT;
+}
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_FUNCTIONS_SERPENTINE_H_
@@ -0,0 +1,47 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_FUNCTIONS_STEER_H_
+#define SNAKE_SRC_MAIN_FUNCTIONS_STEER_H_
+
+#ifndef TEST
+
+#include <Any/View.h>
+#include <Struct/Size.h>
+#include <SDL.h>
+#include "serpentine.h"
+#include "../Any/Enums.h"
+
+using ii887522::viewify::View;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+// It queues the keys which keep a snake just laid with the length given moving along the serpentine of the board, so that it
+// does not die until it reaches the end of the serpentine.
+// Param page: the keys are sent to it
+// Param boardSize: the number of cells on each side of the board including the walls
+// Param snakeLength: the number of segments the snake is laid with, it must be at least 1
+// See also serpentine.h for more details
+inline void steerAlongSerpentine(View*const page, const Size<unsigned int>& boardSize, const unsigned int snakeLength) {
+  SDL_KeyboardEvent keyEvent{ };
+  keyEvent.type = SDL_KEYDOWN;
+  // The head is laid at the serpentine index snakeLength - 1 and has already started moving into the next cell. 1 key is taken
+  // whenever it reaches a cell, which turns it towards the cell after.
+  for (auto i{ snakeLength }; i < (boardSize.w - 2u) * (boardSize.h - 2u) - 1u; ++i) {
+    switch (getSerpentineDirection(boardSize, i)) {
+      case Direction::UP: keyEvent.keysym.sym = SDLK_w;
+        break;
+      case Direction::RIGHT: keyEvent.keysym.sym = SDLK_d;
+        break;
+      case Direction::DOWN: keyEvent.keysym.sym = SDLK_s;
+        break;
+      case Direction::LEFT: keyEvent.keysym.sym = SDLK_a;
+    }
+    page->reactKeyDown(keyEvent);
+  }
+}
+
+}  // namespace ii887522::snake
+
+#endif
+#endif  // SNAKE_SRC_MAIN_FUNCTIONS_STEER_H_
@@ -0,0 +1,32 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_FUNCTIONS_STREAM_EXT_H_
+#define SNAKE_SRC_MAIN_FUNCTIONS_STREAM_EXT_H_
+
+#include <istream>
+#include <ostream>
+#include <type_traits>
+
+using std::istream;
+using std::ostream;
+using std::is_trivially_copyable_v;
+
+namespace ii887522::snake {
+
+// Writes the value given in host byte order.
+template <typename T> void write(ostream& stream, const T& value) {
+  static_assert(is_trivially_copyable_v<T>, "Only trivially copyable values can be written as raw bytes!");
+  stream.write(reinterpret_cast<const char*>(&value), sizeof value);
+}
+
+// Reads a value written by write(ostream&, const T&).
+template <typename T> T read(istream& stream) {
+  static_assert(is_trivially_copyable_v<T>, "Only trivially copyable values can be read as raw bytes!");
+  T value;
+  stream.read(reinterpret_cast<char*>(&value), sizeof value);
+  return value;
+}
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_FUNCTIONS_STREAM_EXT_H_
@@ -0,0 +1,24 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_FUNCTIONS_TIME_EXT_H_
+#define SNAKE_SRC_MAIN_FUNCTIONS_TIME_EXT_H_
+
+#include <string>
+#include <chrono>  // NOLINT(build/c++11)
+
+using std::string;
+using std::to_string;
+using std::chrono::system_clock;
+using std::chrono::duration_cast;
+using std::chrono::milliseconds;
+
+namespace ii887522::snake {
+
+// Return: the number of milliseconds since epoch, it is suitable to be used as a file name which sorts by creation time
+inline string getTimestamp() {
+  return to_string(duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count());
+}
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_FUNCTIONS_TIME_EXT_H_
@@ -0,0 +1,161 @@
+// Copyright ii887522
+
+#include "trace.h"
+#include <string>
+#include <vector>
+#include <memory>
+#include <fstream>
+#include <filesystem>
+#include <thread>  // NOLINT(build/c++11)
+#include <mutex>  // NOLINT(build/c++11)
+#include <condition_variable>  // NOLINT(build/c++11)
+#include <atomic>
+#include <chrono>  // NOLINT(build/c++11)
+#include "../Any/TraceRing.h"
+#include "../Struct/TraceEvent.h"
+
+using std::string;
+using std::vector;
+using std::unique_ptr;
+using std::make_unique;
+using std::ofstream;
+using std::filesystem::path;
+using std::filesystem::create_directories;
+using std::thread;
+using std::mutex;
+using std::lock_guard;
+using std::unique_lock;
+using std::condition_variable;
+using std::atomic;
+using std::memory_order_relaxed;
+using std::memory_order_release;
+using std::memory_order_acquire;
+using std::chrono::high_resolution_clock;
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+namespace ii887522::snake {
+
+static constexpr milliseconds flushInterval{ 50 };
+
+// Producers read startTime only after seeing isEnabled set, and it is only written by the first session, so it is never written
+// while a producer may be reading it
+static atomic<bool> isEnabled{ false };
+static high_resolution_clock::time_point startTime;
+static bool hasStarted{ false };
+
+static mutex ringsLock;
+static vector<unique_ptr<TraceRing>> rings;  // a ring is never freed once created because its thread may still be using it
+static thread_local TraceRing* ring{ nullptr };
+static thread_local unsigned int threadId{ 0u };
+
+static mutex flusherLock;  // it guards everything below
+static condition_variable flusherCondition;
+static thread flusher;
+static bool isFlusherStopping{ false };
+static ofstream file;
+static bool hasWrittenEvent{ false };
+
+static TraceRing& getRing() {
+  if (ring) return *ring;
+  const lock_guard lock{ ringsLock };
+  rings.push_back(make_unique<TraceRing>());
+  ring = rings.back().get();
+  threadId = static_cast<unsigned int>(rings.size());
+  return *ring;
+}
+
+static void push(const char*const name, const char*const category, const char phase, const high_resolution_clock::time_point& begin,
+  const long long duration) {
+  TraceEvent event;
+  auto nameSize{ 0u };
+  for (; name[nameSize] != '\0' && nameSize != TraceEvent::NAME_CAPACITY - 1u; ++nameSize) event.name[nameSize] = name[nameSize];
+  event.name[nameSize] = '\0';
+  event.category = category;
+  event.phase = phase;
+  auto& l_ring{ getRing() };
+  event.threadId = threadId;
+  event.timestamp = duration_cast<microseconds>(begin - startTime).count();
+  event.duration = duration;
+  l_ring.push(event);
+}
+
+// It must only be called by the flusher thread or after the flusher thread has stopped
+static void flush() {
+  vector<TraceRing*> l_rings;
+  {
+    const lock_guard lock{ ringsLock };
+    for (const auto& l_ring : rings) l_rings.push_back(l_ring.get());
+  }
+  for (const auto l_ring : l_rings) {
+    l_ring->drain([](const TraceEvent& event) {
+      file << (hasWrittenEvent ? ",\n" : "\n") << "{ \"name\": \"" << event.name << "\", \"cat\": \"" << event.category <<
+        "\", \"ph\": \"" << event.phase << "\", \"pid\": 1, \"tid\": " << event.threadId << ", \"ts\": " << event.timestamp;
+      if (event.phase == 'X') file << ", \"dur\": " << event.duration;
+      else file << ", \"s\": \"t\"";
+      file << " }";
+      hasWrittenEvent = true;
+    });
+  }
+  file.flush();
+}
+
+static void runFlusher() {
+  unique_lock lock{ flusherLock };
+  while (!isFlusherStopping) {
+    flusherCondition.wait_for(lock, flushInterval);
+    flush();
+  }
+}
+
+void startTracing(const string& filePath) {
+  const lock_guard lock{ flusherLock };
+  if (isEnabled.load(memory_order_relaxed)) return;
+  if (path{ filePath }.has_parent_path()) create_directories(path{ filePath }.parent_path());
+  file.open(filePath);
+  file << "{ \"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+  {
+    // Discard the events left behind by the previous session
+    const lock_guard ringsGuard{ ringsLock };
+    for (const auto& l_ring : rings) l_ring->drain([](const TraceEvent&) { });
+  }
+  hasWrittenEvent = false;
+  isFlusherStopping = false;
+  // Later sessions keep the timeline of the first one, so the timestamps of a session may not begin from 0
+  if (!hasStarted) startTime = high_resolution_clock::now();
+  hasStarted = true;
+  isEnabled.store(true, memory_order_release);
+  flusher = thread{ runFlusher };
+}
+
+void stopTracing() {
+  {
+    const lock_guard lock{ flusherLock };
+    if (!isEnabled.load(memory_order_relaxed)) return;
+    isEnabled.store(false, memory_order_relaxed);
+    isFlusherStopping = true;
+  }
+  flusherCondition.notify_one();
+  flusher.join();
+  flush();
+  file << "\n] }\n";
+  file.close();
+}
+
+bool isTracing() {
+  return isEnabled.load(memory_order_acquire);
+}
+
+void traceInstant(const char*const name, const char*const category) {
+  if (!isTracing()) return;
+  push(name, category, 'i', high_resolution_clock::now(), 0ll);
+}
+
+void traceComplete(const char*const name, const char*const category, const high_resolution_clock::time_point& begin,
+  const high_resolution_clock::time_point& end) {
+  if (!isTracing()) return;
+  push(name, category, 'X', begin, duration_cast<microseconds>(end - begin).count());
+}
+
+}  // namespace ii887522::snake
@@ -0,0 +1,40 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_FUNCTIONS_TRACE_H_
+#define SNAKE_SRC_MAIN_FUNCTIONS_TRACE_H_
+
+#include <string>
+#include <chrono>  // NOLINT(build/c++11)
+
+using std::string;
+using std::chrono::high_resolution_clock;
+
+namespace ii887522::snake {
+
+// Tracing records a timeline of events into a file of the Chrome trace event format which can be opened in chrome://tracing or
+// https://ui.perfetto.dev. Every thread pushes its events into its own lock-free ring buffer and a background thread flushes
+// them into the file, so recording an event never blocks nor touches the file system. All the functions below are cheap
+// no-ops while tracing is stopped.
+// Thread Safe
+
+// Param filePath: the file will be overwritten. It is a no-op if tracing has started.
+void startTracing(const string& filePath);
+
+// Flushes the remaining events and closes the file. It is a no-op if tracing has stopped.
+void stopTracing();
+
+bool isTracing();
+
+// Param name: it is copied, so it does not need to outlive the call
+// Param category: it must point to a string literal
+void traceInstant(const char*const name, const char*const category);
+
+// Records an event which starts at begin and ends at end.
+// Param name: it is copied, so it does not need to outlive the call
+// Param category: it must point to a string literal
+void traceComplete(const char*const name, const char*const category, const high_resolution_clock::time_point& begin,
+  const high_resolution_clock::time_point& end);
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_FUNCTIONS_TRACE_H_
@@ -0,0 +1,190 @@
+// Copyright ii887522
+
+#include "Arena.h"
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <Struct/Vector.h>
+#include <vector>
+#include <algorithm>
+#include "../Any/Enums.h"
+#include "../Any/CellGrid.h"
+#include "../Any/ThreadPool.h"
+#include "../Struct/ArenaSnake.h"
+#include "../Functions/random_ext.h"
+
+using std::vector;
+using std::sort;
+using std::binary_search;
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+using ii887522::nitro::Vector;
+
+namespace ii887522::snake {
+
+static constexpr Vector<int> getSpeed(const Direction direction) {
+  switch (direction) {
+    case Direction::UP: return Vector{ 0, -1 };
+    case Direction::RIGHT: return Vector{ 1, 0 };
+    case Direction::DOWN: return Vector{ 0, 1 };
+    case Direction::LEFT: return Vector{ -1, 0 };
+    default: return Vector{ 0, 0 };
+  }
+}
+
+static constexpr Point<unsigned int> move(const Point<unsigned int>& position, const Direction direction) {
+  return static_cast<Point<unsigned int>>(static_cast<Point<int>>(position) + getSpeed(direction));
+}
+
+static constexpr bool isSafe(const CellType cell) {
+  return cell == CellType::BACKGROUND || cell == CellType::FOOD;
+}
+
+Arena::Arena(const Size<unsigned int>& size, const unsigned int snakeCount, const unsigned int foodCount,
+  const unsigned long long seed, ThreadPool& threadPool) : cells{ size }, threadPool{ threadPool }, snakes(snakeCount),
+  maxFoodCount{ foodCount }, foodCount{ 0u }, randomState{ seed }, tick{ 0u }, aliveCount{ 0u }, deathCount{ 0ull },
+  bandHeads((size.h + BAND_HEIGHT - 1u) / BAND_HEIGHT), bandTails((size.h + BAND_HEIGHT - 1u) / BAND_HEIGHT) {
+  for (auto& snake : snakes) {
+    snake.randomState = nextRandom(&randomState);
+    spawn(snake);
+  }
+  respawn();
+}
+
+void Arena::spawn(ArenaSnake& snake) {
+  const auto position{ cells.getRandomBackgroundCell(&randomState) };
+  if (cells.get(position) == CellType::WALL) {
+    snake.respawnTick = tick + RESPAWN_DELAY;
+    return;
+  }
+  snake.body.push_front(position);
+  cells.set(position, CellType::SNAKE_HEAD);
+  snake.direction = static_cast<Direction>(nextRandom(&snake.randomState, static_cast<unsigned int>(Direction::COUNT)));
+  snake.score = 0u;
+  ++aliveCount;
+}
+
+void Arena::decide(ArenaSnake& snake) const {
+  const auto& head{ snake.body.front() };
+  const Direction directions[]{
+    snake.direction, static_cast<Direction>((static_cast<unsigned int>(snake.direction) + 3u) % 4u),
+    static_cast<Direction>((static_cast<unsigned int>(snake.direction) + 1u) % 4u)
+  };  // straight, left and right
+  CellType nextCells[3u];
+  for (auto i{ 0u }; i != 3u; ++i) nextCells[i] = cells.get(move(head, directions[i]));
+  auto choice{ 0u };
+  if (nextCells[0u] == CellType::FOOD) {
+    choice = 0u;
+  } else if (nextCells[1u] == CellType::FOOD || nextCells[2u] == CellType::FOOD) {
+    choice = nextCells[1u] == CellType::FOOD ? 1u : 2u;
+  } else if (!isSafe(nextCells[0u]) || nextRandom(&snake.randomState, TURN_CHANCE) == 0u) {
+    const auto turn{ 1u + nextRandom(&snake.randomState, 2u) };
+    if (isSafe(nextCells[turn])) choice = turn;
+    else if (isSafe(nextCells[3u - turn])) choice = 3u - turn;
+  }
+  snake.direction = directions[choice];
+  snake.next = move(head, snake.direction);
+  snake.isEating = nextCells[choice] == CellType::FOOD;
+}
+
+void Arena::bucket() {
+  for (auto& heads : bandHeads) heads.clear();
+  for (auto& tails : bandTails) tails.clear();
+  for (auto i{ 0u }; i != snakes.size(); ++i) {
+    auto& snake{ snakes[i] };
+    snake.isMoving = !snake.body.empty();
+    snake.isDying = false;
+    if (!snake.isMoving) continue;
+    bandHeads[snake.next.y / BAND_HEIGHT].push_back(i);
+    if (!snake.isEating) bandTails[snake.body.back().y / BAND_HEIGHT].push_back(getKey(snake.body.back()));
+  }
+}
+
+void Arena::findDying(const unsigned int band) {
+  auto& heads{ bandHeads[band] };
+  auto& tails{ bandTails[band] };
+  sort(heads.begin(), heads.end(), [this](const unsigned int left, const unsigned int right) {
+    return getKey(snakes[left].next) < getKey(snakes[right].next);
+  });
+  sort(tails.begin(), tails.end());
+  for (auto begin{ 0u }; begin != heads.size(); ) {
+    const auto key{ getKey(snakes[heads[begin]].next) };
+    auto end{ begin + 1u };
+    while (end != heads.size() && getKey(snakes[heads[end]].next) == key) ++end;
+    const auto cell{ cells.get(snakes[heads[begin]].next) };
+    const auto isDying{
+      end - begin > 1u || cell == CellType::WALL || (!isSafe(cell) && !binary_search(tails.begin(), tails.end(), key))
+    };
+    for (auto i{ begin }; i != end; ++i) snakes[heads[i]].isDying = isDying;
+    begin = end;
+  }
+}
+
+void Arena::apply() {
+  // Every cell left is cleared before any cell entered is set, so a head can move into a tail leaving in the same tick
+  for (auto& snake : snakes) {
+    if (!snake.isMoving) continue;
+    if (snake.isDying) {
+      for (const auto& position : snake.body) cells.set(position, CellType::BACKGROUND);
+      snake.body.clear();
+      snake.respawnTick = tick + RESPAWN_DELAY;
+      --aliveCount;
+      ++deathCount;
+    } else if (!snake.isEating) {
+      cells.set(snake.body.back(), CellType::BACKGROUND);
+      snake.body.pop_back();
+    }
+  }
+  for (auto& snake : snakes) {
+    if (!snake.isMoving || snake.isDying) continue;
+    if (!snake.body.empty()) cells.set(snake.body.front(), CellType::SNAKE_BODY);
+    snake.body.push_front(snake.next);
+    cells.set(snake.next, CellType::SNAKE_HEAD);
+    if (!snake.isEating) continue;
+    ++snake.score;
+    --foodCount;
+  }
+}
+
+void Arena::respawn() {
+  for (auto& snake : snakes) {
+    if (snake.body.empty() && snake.respawnTick <= tick) spawn(snake);
+  }
+  while (foodCount != maxFoodCount) {
+    const auto position{ cells.getRandomBackgroundCell(&randomState) };
+    if (cells.get(position) == CellType::WALL) return;
+    cells.set(position, CellType::FOOD);
+    ++foodCount;
+  }
+}
+
+unsigned long long Arena::getChecksum() const {
+  // It is FNV-1a
+  auto result{ 0xcbf29ce484222325ull };
+  const auto add{ [&result](const unsigned long long value) {
+    result = (result ^ value) * 0x100000001b3ull;
+  } };
+  add(tick);
+  for (const auto& snake : snakes) {
+    add(snake.body.size());
+    add(static_cast<unsigned long long>(snake.direction));
+    for (const auto& position : snake.body) add(getKey(position));
+  }
+  return result;
+}
+
+void Arena::step() {
+  ++tick;
+  threadPool.parallelFor(static_cast<unsigned int>(snakes.size()), [this](const unsigned int begin, const unsigned int end) {
+    for (auto i{ begin }; i != end; ++i) {
+      if (!snakes[i].body.empty()) decide(snakes[i]);
+    }
+  });
+  bucket();
+  threadPool.parallelFor(static_cast<unsigned int>(bandHeads.size()), [this](const unsigned int begin, const unsigned int end) {
+    for (auto i{ begin }; i != end; ++i) findDying(i);
+  });
+  apply();
+  respawn();
+}
+
+}  // namespace ii887522::snake
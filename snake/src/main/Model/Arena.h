@@ -0,0 +1,107 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_MODEL_ARENA_H_
+#define SNAKE_SRC_MAIN_MODEL_ARENA_H_
+
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <vector>
+#include "../Any/Enums.h"
+#include "../Any/CellGrid.h"
+#include "../Any/ThreadPool.h"
+#include "../Struct/ArenaSnake.h"
+
+using std::vector;
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+// It is a tick based board shared by many bot driven snakes and foods. Every snake moves at the same time in each tick:
+//   1. In parallel, each snake decides where to go by looking at the board as it was at the beginning of the tick.
+//   2. The heads and the tails leaving their cells are bucketed into bands of rows, which form a spatial hash of the board.
+//   3. In parallel, each band finds the snakes dying in it. A snake dies when its head moves into a wall, into a cell another head
+//      moves into as well, or into a cell occupied at the beginning of the tick unless that cell is a tail leaving it.
+//   4. The board is updated, dead snakes are removed and respawned after RESPAWN_DELAY ticks, and eaten foods are replaced.
+// Each snake has its own random number generator and every step which is not run in parallel walks the snakes in index order,
+// so the same seed always plays the same game no matter how many threads the thread pool has.
+// Not Thread Safe
+// See also ../Any/ThreadPool.h for more details
+class Arena final {
+  // remove copy semantics
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  // remove move semantics
+  Arena(Arena&&) = delete;
+  Arena& operator=(Arena&&) = delete;
+
+  static constexpr auto BAND_HEIGHT{ 64u };  // the number of rows in each band
+  static constexpr auto RESPAWN_DELAY{ 16u };  // in ticks
+  static constexpr auto TURN_CHANCE{ 8u };  // a snake which can go straight turns once every this many ticks on average
+
+  CellGrid cells;
+  ThreadPool& threadPool;
+  vector<ArenaSnake> snakes;
+  const unsigned int maxFoodCount;
+  unsigned int foodCount;
+  unsigned long long randomState;  // it drives everything which is not decided by a snake
+  unsigned int tick;
+  unsigned int aliveCount;
+  unsigned long long deathCount;
+  vector<vector<unsigned int>> bandHeads;  // the indices of the snakes whose heads move into each band
+  vector<vector<unsigned long long>> bandTails;  // the keys of the tails leaving their cells in each band
+
+  constexpr unsigned long long getKey(const Point<unsigned int>& position) const {
+    return static_cast<unsigned long long>(position.y) * cells.getSize().w + position.x;
+  }
+
+  void spawn(ArenaSnake&);
+
+  // It decides where the snake goes and whether it eats there.
+  // Param snake: it must be alive
+  void decide(ArenaSnake& snake) const;
+
+  void bucket();
+
+  // Param band: the index of the band to find the snakes dying in
+  void findDying(const unsigned int band);
+
+  void apply();
+  void respawn();
+
+ public:
+  // Param size: each side must be at least 4 cells
+  // Param seed: the same seed always plays the same game
+  explicit Arena(const Size<unsigned int>& size, const unsigned int snakeCount, const unsigned int foodCount,
+    const unsigned long long seed, ThreadPool&);
+
+  constexpr const CellGrid& getCells() const {
+    return cells;
+  }
+
+  constexpr const vector<ArenaSnake>& getSnakes() const {
+    return snakes;
+  }
+
+  constexpr unsigned int getTick() const {
+    return tick;
+  }
+
+  constexpr unsigned int getAliveCount() const {
+    return aliveCount;
+  }
+
+  constexpr unsigned long long getDeathCount() const {
+    return deathCount;
+  }
+
+  // Return: a hash of every snake, it is the same after the same number of ticks from the same seed
+  unsigned long long getChecksum() const;
+
+  void step();
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_MODEL_ARENA_H_
@@ -0,0 +1,90 @@
+// Copyright ii887522
+
+#include "Simulation.h"
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <Struct/Vector.h>
+#include "../Any/Enums.h"
+#include "../Struct/Keyframe.h"
+#include "../Any/CellGrid.h"
+
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+using ii887522::nitro::Vector;
+
+namespace ii887522::snake {
+
+static constexpr Vector<int> getSpeed(const Direction direction) {
+  switch (direction) {
+    case Direction::UP: return Vector{ 0, -1 };
+    case Direction::RIGHT: return Vector{ 1, 0 };
+    case Direction::DOWN: return Vector{ 0, 1 };
+    case Direction::LEFT: return Vector{ -1, 0 };
+    default: return Vector{ 0, 0 };
+  }
+}
+
+Simulation::Simulation(const Size<unsigned int>& size) : cells{ size }, direction{ Direction::UP }, food{ 0u, 0u }, hasFood{ false },
+  score{ 0u }, tick{ 0u }, isDead{ false } { }
+
+void Simulation::reborn(const Direction p_direction) {
+  for (const auto& position : body) cells.set(position, CellType::BACKGROUND);
+  body.clear();
+  body.push_front(Point{ cells.getSize().w >> 1u, cells.getSize().h >> 1u });
+  cells.set(body.front(), CellType::SNAKE_HEAD);
+  direction = p_direction;
+  score = 0u;
+  tick = 0u;
+  isDead = false;
+}
+
+void Simulation::setFood(const Point<unsigned int>& position) {
+  if (hasFood && cells.get(food) == CellType::FOOD) cells.set(food, CellType::BACKGROUND);
+  food = position;
+  hasFood = true;
+  cells.set(food, CellType::FOOD);
+}
+
+bool Simulation::step(const Direction p_direction) {
+  if (isDead) return false;
+  ++tick;
+  direction = p_direction;
+  const auto next{ static_cast<Point<unsigned int>>(static_cast<Point<int>>(body.front()) + getSpeed(direction)) };
+  const auto nextCell{ cells.get(next) };
+  if (nextCell == CellType::WALL || (nextCell == CellType::SNAKE_BODY && (next.x != body.back().x || next.y != body.back().y))) {
+    isDead = true;
+    return false;
+  }
+  const auto isEatFood{ nextCell == CellType::FOOD };
+  if (isEatFood) {
+    hasFood = false;
+    ++score;
+  } else {
+    cells.set(body.back(), CellType::BACKGROUND);
+    body.pop_back();
+  }
+  if (!body.empty()) cells.set(body.front(), CellType::SNAKE_BODY);
+  body.push_front(next);
+  cells.set(next, CellType::SNAKE_HEAD);
+  return isEatFood;
+}
+
+Keyframe Simulation::makeKeyframe() const {
+  return Keyframe{ tick, score, direction, isDead, hasFood, food, vector<Point<unsigned int>>(body.begin(), body.end()) };
+}
+
+void Simulation::restore(const Keyframe& keyframe) {
+  cells.clear();
+  body.assign(keyframe.body.begin(), keyframe.body.end());
+  for (const auto& position : body) cells.set(position, CellType::SNAKE_BODY);
+  if (!body.empty()) cells.set(body.front(), CellType::SNAKE_HEAD);
+  hasFood = keyframe.hasFood;
+  food = keyframe.food;
+  if (hasFood) cells.set(food, CellType::FOOD);
+  direction = keyframe.direction;
+  score = keyframe.score;
+  tick = keyframe.tick;
+  isDead = keyframe.isDead;
+}
+
+}  // namespace ii887522::snake
@@ -0,0 +1,104 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_MODEL_SIMULATION_H_
+#define SNAKE_SRC_MAIN_MODEL_SIMULATION_H_
+
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <Struct/Vector.h>
+#include <deque>
+#include "../Any/Enums.h"
+#include "../Struct/Keyframe.h"
+#include "../Any/CellGrid.h"
+
+using std::deque;
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+using ii887522::nitro::Vector;
+
+namespace ii887522::snake {
+
+// It is the discrete, tick based counterpart of SnakeModel and Food. The snake moves exactly 1 cell per tick, so the same
+// starting state and the same inputs always produce the same game. It is used wherever a game has to be reproduced rather
+// than animated, e.g. replays.
+// Not Thread Safe
+class Simulation final {
+  // remove copy semantics
+  Simulation(const Simulation&) = delete;
+  Simulation& operator=(const Simulation&) = delete;
+
+  // remove move semantics
+  Simulation(Simulation&&) = delete;
+  Simulation& operator=(Simulation&&) = delete;
+
+  CellGrid cells;
+  deque<Point<unsigned int>> body;  // the first element is the head
+  Direction direction;
+  Point<unsigned int> food;
+  bool hasFood;
+  unsigned int score;
+  unsigned int tick;
+  bool isDead;
+
+ public:
+  explicit Simulation(const Size<unsigned int>& size);
+
+  constexpr const Size<unsigned int>& getSize() const {
+    return cells.getSize();
+  }
+
+  CellType get(const Point<unsigned int>& position) const {
+    return cells.get(position);
+  }
+
+  // Param randomState: it is advanced, see also ../Functions/random_ext.h for more details
+  // Return: a random background cell, or a wall if there is none
+  Point<unsigned int> getRandomBackgroundCell(unsigned long long*const randomState) const {
+    return cells.getRandomBackgroundCell(randomState);
+  }
+
+  constexpr const deque<Point<unsigned int>>& getBody() const {
+    return body;
+  }
+
+  constexpr Direction getDirection() const {
+    return direction;
+  }
+
+  constexpr const Point<unsigned int>& getFood() const {
+    return food;
+  }
+
+  constexpr bool isFoodSpawned() const {
+    return hasFood;
+  }
+
+  constexpr unsigned int getScore() const {
+    return score;
+  }
+
+  constexpr unsigned int getTick() const {
+    return tick;
+  }
+
+  constexpr bool isOver() const {
+    return isDead;
+  }
+
+  // Puts a new snake of length 1 in the middle of the board facing the direction given and rewinds the tick to 0.
+  void reborn(const Direction);
+
+  // Param position: it must point to a background cell
+  void setFood(const Point<unsigned int>& position);
+
+  // Advances the game by 1 tick moving the snake in the direction given.
+  // Return: true if the snake has eaten the food in this tick, false otherwise
+  bool step(const Direction);
+
+  Keyframe makeKeyframe() const;
+  void restore(const Keyframe&);
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_MODEL_SIMULATION_H_
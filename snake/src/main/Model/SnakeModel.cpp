@@ -3,32 +3,35 @@
 #include "SnakeModel.h"
 #include <Struct/Point.h>
 #include <Struct/Vector.h>
-#include <Struct/Size.h>
 #include <Any/AnimatedAny.h>
 #include <Any/Reactive.h>
 #include <Functions/queue_ext.h>
-#include <Any/Map.h>
 #include <SDL.h>
 #include <functional>
 #include <random>
 #include "Any/Enums.h"
+#include "../Any/CellGrid.h"
+#include "../Any/Level.h"
+#include "../Struct/SpawnPoint.h"
+#include "../Functions/serpentine.h"
 
 using std::function;
 using std::default_random_engine;
+using std::uniform_int_distribution;
 using ii887522::viewify::Point;
 using ii887522::nitro::Vector;
-using ii887522::viewify::Size;
 using ii887522::nitro::AnimatedAny;
 using ii887522::nitro::Reactive;
 using ii887522::nitro::clear;
-using ii887522::viewify::Map;
 
 namespace ii887522::snake {
 
-SnakeModel::SnakeModel(const Size<int>& wallSize, const int cellSize, default_random_engine& randomEngine, Map<CellType>& map,
-  Reactive<bool>*const hasEatFood, const function<void()>& onHit) : wallSize{ wallSize }, cellSize{ cellSize }, duration{ 62u },
+SnakeModel::SnakeModel(const int cellSize, default_random_engine& randomEngine, CellGrid& map,
+  Reactive<bool>*const hasEatFood, const function<void()>& onHit, const function<void()>& onReborn,
+  const function<void(Direction)>& onMove, const unsigned int length) : cellSize{ cellSize }, duration{ 62u },
   directions{ 0u, static_cast<unsigned int>(Direction::COUNT) - 1u }, randomEngine{ randomEngine }, isDead{ false }, map{ map },
-  hasEatFood{ *hasEatFood }, prevTailSpeed{ 0, 0 }, onHit{ onHit } {
+  hasEatFood{ *hasEatFood }, prevTailSpeed{ 0, 0 }, onHit{ onHit }, onReborn{ onReborn }, onMove{ onMove },
+  length{ length } {
   reborn();
 }
 
@@ -125,13 +128,72 @@ void SnakeModel::setRandomSpeed() {
   prevTailSpeed = speeds.front();
 }
 
+Vector<int> SnakeModel::getSpeed(const Direction direction) {
+  switch (direction) {
+    case Direction::UP: return Vector{ 0, -1 };
+    case Direction::RIGHT: return Vector{ 1, 0 };
+    case Direction::DOWN: return Vector{ 0, 1 };
+    default: return Vector{ -1, 0 };
+  }
+}
+
+void SnakeModel::addLaidSegment(const unsigned int index) {
+  const auto i{ static_cast<unsigned int>(positions.size()) };
+  positions.push_back(AnimatedAny<Point<float>>::Builder{
+    static_cast<Point<float>>(getSerpentinePosition(map.getSize(), length - 1u - index)), [this, i]() {
+      if (isMoveUp(i))
+        map.set(static_cast<Point<unsigned int>>(positions[i].get() + Vector{ 0.f, 1.f }), CellType::BACKGROUND);
+      else if (isMoveRight(i))
+        map.set(static_cast<Point<unsigned int>>(positions[i].get() - Vector{ 1.f, 0.f }), CellType::BACKGROUND);
+      else if (isMoveDown(i))
+        map.set(static_cast<Point<unsigned int>>(positions[i].get() - Vector{ 0.f, 1.f }), CellType::BACKGROUND);
+      else if (isMoveLeft(i))
+        map.set(static_cast<Point<unsigned int>>(positions[i].get() + Vector{ 1.f, 0.f }), CellType::BACKGROUND);
+      followPrevCell(i);
+    }
+  }.setDuration(duration).build());
+  map.set(static_cast<Point<unsigned int>>(positions.back().get()), CellType::SNAKE_BODY);
+  // Each segment heads to where the segment in front of it is, the same as followPrevCell() does
+  speeds.push_back(getSpeed(getSerpentineDirection(map.getSize(), length - 1u - index)));
+}
+
+void SnakeModel::lay() {
+  map.set(static_cast<Point<unsigned int>>(positions.front().get()), CellType::SNAKE_HEAD);
+  speeds.push_back(getSpeed(getSerpentineDirection(map.getSize(), length - 1u)));
+  for (auto i{ 1u }; i != length; ++i) addLaidSegment(i);
+  prevTailSpeed = speeds.back();
+}
+
+const SpawnPoint* SnakeModel::findSpawnPoint() {
+  const auto level{ map.getLevel() };
+  if (!level || level->getSpawnPointCount() == 0u) return nullptr;
+  const auto count{ level->getSpawnPointCount() };
+  const auto begin{ uniform_int_distribution<unsigned int>{ 0u, count - 1u }(randomEngine) };
+  for (auto i{ 0u }; i != count; ++i) {
+    const auto& spawnPoint{ level->getSpawnPoint((begin + i) % count) };
+    if (map.get(spawnPoint.position) == CellType::BACKGROUND) return &spawnPoint;
+  }
+  return nullptr;
+}
+
+Point<unsigned int> SnakeModel::findFreeCell() {
+  const Point center{ map.getSize().w >> 1u, map.getSize().h >> 1u };
+  if (map.get(center) == CellType::BACKGROUND) return center;
+  auto randomState{ static_cast<unsigned long long>(randomEngine()) };
+  return map.getRandomBackgroundCell(&randomState);
+}
+
 void SnakeModel::reborn() {
   clearSnakeInMap();
   positions.clear();
   speeds.clear();
   clear(&keyCodes);
+  const auto spawnPoint{ length == 0u ? findSpawnPoint() : nullptr };
   positions.push_back(AnimatedAny<Point<float>>::Builder{
-    static_cast<Point<float>>(Point{ wallSize.w / cellSize >> 1u, wallSize.h / cellSize >> 1u }), [this]() {
+    static_cast<Point<float>>(
+      length != 0u ? getSerpentinePosition(map.getSize(), length - 1u) :
+        spawnPoint ? spawnPoint->position : findFreeCell()
+    ), [this]() {
       if (isMoveUp(0u))
         map.set(static_cast<Point<unsigned int>>(positions.front().get() + Vector{ 0.f, 1.f }), CellType::BACKGROUND);
       else if (isMoveRight(0u))
@@ -143,12 +205,25 @@ void SnakeModel::reborn() {
       if (isDead) return;
       prevTailSpeed = speeds.back();
       reactNextKeyCode();
+      onMove(getDirection(0u));
       positions.front().set(positions.front().get() + speeds.front());
     }
   }.setDuration(duration).build());
-  map.set(static_cast<Point<unsigned int>>(positions.front().get()), CellType::SNAKE_HEAD);
-  setRandomSpeed();
+  if (length == 0u) {
+    map.set(static_cast<Point<unsigned int>>(positions.front().get()), CellType::SNAKE_HEAD);
+    if (spawnPoint) {
+      speeds.push_back(getSpeed(spawnPoint->direction));
+      prevTailSpeed = speeds.front();
+    } else {
+      setRandomSpeed();
+    }
+  } else {
+    lay();
+  }
+  onReborn();
+  onMove(getDirection(0u));
   positions.front().set(positions.front().get() + speeds.front());
+  for (auto i{ 1u }; i < positions.size(); ++i) positions[i].set(positions[i].get() + speeds[i]);
 }
 
 bool SnakeModel::isMoveUp(const unsigned int i) const {
@@ -167,6 +242,10 @@ bool SnakeModel::isMoveLeft(const unsigned int i) const {
   return speeds[i].x < 0 && speeds[i].y == 0;
 }
 
+Direction SnakeModel::getDirection(const unsigned int i) const {
+  return isMoveUp(i) ? Direction::UP : isMoveRight(i) ? Direction::RIGHT : isMoveDown(i) ? Direction::DOWN : Direction::LEFT;
+}
+
 void SnakeModel::followPrevCell(const unsigned int i) {
   if (positions[i].get().y > positions[i - 1].get().y) {
     speeds[i] = Vector{ 0, -1 };
@@ -4,18 +4,19 @@
 #define SNAKE_SRC_MAIN_MODEL_SNAKEMODEL_H_
 
 #include <Struct/Point.h>
-#include <Struct/Size.h>
 #include <Struct/Vector.h>
 #include <Any/AnimatedAny.h>
 #include <Functions/math_ext.h>
 #include <Any/Reactive.h>
-#include <Any/Map.h>
 #include <SDL.h>
 #include <queue>
 #include <functional>
 #include <random>
 #include <vector>
 #include "../Any/Enums.h"
+#include "../Any/CellGrid.h"
+#include "../Any/TrackingAllocator.h"
+#include "../Struct/SpawnPoint.h"
 
 using std::queue;
 using std::function;
@@ -23,11 +24,9 @@ using std::default_random_engine;
 using std::uniform_int_distribution;
 using std::vector;
 using ii887522::viewify::Point;
-using ii887522::viewify::Size;
 using ii887522::nitro::Vector;
 using ii887522::nitro::AnimatedAny;
 using ii887522::nitro::Reactive;
-using ii887522::viewify::Map;
 
 namespace ii887522::snake {
 
@@ -41,23 +40,21 @@ class SnakeModel final {
   SnakeModel(SnakeModel&&) = delete;
   SnakeModel& operator=(SnakeModel&&) = delete;
 
-  enum class Direction : unsigned int {
-    UP, RIGHT, DOWN, LEFT, COUNT
-  };
-
-  const Size<int> wallSize;
   const int cellSize;
   const unsigned int duration;  // animation duration
   uniform_int_distribution<unsigned int> directions;
   default_random_engine& randomEngine;
-  vector<AnimatedAny<Point<float>>> positions;
-  vector<Vector<int>> speeds;
+  vector<AnimatedAny<Point<float>>, TrackingAllocator<AnimatedAny<Point<float>>, MemoryCategory::SNAKE_SEGMENTS>> positions;
+  vector<Vector<int>, TrackingAllocator<Vector<int>, MemoryCategory::SNAKE_SEGMENTS>> speeds;
   queue<SDL_Keycode> keyCodes;
   bool isDead;
-  Map<CellType>& map;
+  CellGrid& map;
   Reactive<bool>& hasEatFood;
   Vector<int> prevTailSpeed;
   const function<void()> onHit;
+  const function<void()> onReborn;
+  const function<void(Direction)> onMove;
+  const unsigned int length;  // the number of segments a new snake is laid with, or 0 if it is born with 1 segment
 
   constexpr bool isEatFood() const {
     return isMoveUp(0u) ? map.get(static_cast<Point<unsigned int>>(positions.front().get())) == CellType::FOOD :
@@ -96,6 +93,21 @@ class SnakeModel final {
   void reactNextKeyCode();
   void clearSnakeInMap();
   void setRandomSpeed();
+
+  static Vector<int> getSpeed(const Direction);
+
+  // Param index: the segment index counted from the head, it must be greater than 0 and less than length
+  void addLaidSegment(const unsigned int index);
+
+  // It lays the rest of a new snake behind its head along the serpentine of the map.
+  void lay();
+
+  // Return: a random spawn point of the level of the map which is not occupied, or nullptr if there is none
+  const SpawnPoint* findSpawnPoint();
+
+  // Return: the center of the board if it is free, otherwise a random free cell, or a wall if there is none
+  Point<unsigned int> findFreeCell();
+
   void reborn();
 
   // Param i: it must be less than the size of positions and speeds
@@ -110,6 +122,9 @@ class SnakeModel final {
   // Param i: it must be less than the size of positions and speeds
   bool isMoveLeft(const unsigned int i) const;
 
+  // Param i: it must be less than the size of positions and speeds
+  Direction getDirection(const unsigned int i) const;
+
   // Param i: it must be greater than 0 and less than the size of positions and speeds
   void followPrevCell(const unsigned int i);
 
@@ -123,14 +138,22 @@ class SnakeModel final {
   void growWhenTailMoveLeftPreviously();
 
  public:
-  explicit SnakeModel(const Size<int>& wallSize, const int cellSize, default_random_engine&, Map<CellType>&, Reactive<bool>*const hasEatFood,
-    const function<void()>& onHit);
+  // Param onReborn: it is called when a new snake is born, before its first move
+  // Param onMove: it is called whenever the head starts moving into the next cell
+  // Param map: the snake is born at a random spawn point of its level if any, otherwise in the middle of it heading a random way
+  // Param length: if it is not 0, a new snake is laid with that many segments along the serpentine of the map instead, heading
+  //   along it with the head at the serpentine index length - 1. It must be less than the number of cells inside the walls. See
+  //   also ../Functions/serpentine.h for more details
+  explicit SnakeModel(const int cellSize, default_random_engine&, CellGrid&, Reactive<bool>*const hasEatFood,
+    const function<void()>& onHit, const function<void()>& onReborn = []() { }, const function<void(Direction)>& onMove = [](const Direction) { },
+    const unsigned int length = 0u);
 
   constexpr int getCellSize() const {
     return cellSize;
   }
 
-  constexpr const vector<AnimatedAny<Point<float>>>& getPositions() const {
+  constexpr const vector<AnimatedAny<Point<float>>, TrackingAllocator<AnimatedAny<Point<float>>, MemoryCategory::SNAKE_SEGMENTS>>&
+  getPositions() const {
     return positions;
   }
 
@@ -0,0 +1,33 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_STRUCT_ARENASNAKE_H_
+#define SNAKE_SRC_MAIN_STRUCT_ARENASNAKE_H_
+
+#include <Struct/Point.h>
+#include <deque>
+#include "../Any/Enums.h"
+
+using std::deque;
+using ii887522::viewify::Point;
+
+namespace ii887522::snake {
+
+// It is 1 bot driven snake of an arena.
+// See also ../Model/Arena.h for more details
+struct ArenaSnake final {
+  deque<Point<unsigned int>> body;  // the first element is the head, it is empty while the snake is dead
+  Direction direction;
+  unsigned long long randomState;  // it drives the decisions of this snake only
+  unsigned int respawnTick;  // the tick when the snake is born again, only meaningful while it is dead
+  unsigned int score;  // the number of foods eaten since the snake was born
+
+  // They are only meaningful during a tick
+  bool isMoving;  // whether the snake was alive at the beginning of the tick
+  Point<unsigned int> next;  // the cell the head moves into
+  bool isEating;
+  bool isDying;
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_STRUCT_ARENASNAKE_H_
@@ -0,0 +1,25 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_STRUCT_HITTARGET_H_
+#define SNAKE_SRC_MAIN_STRUCT_HITTARGET_H_
+
+#ifndef TEST
+
+#include <Any/View.h>
+#include <SDL.h>
+
+using ii887522::viewify::View;
+
+namespace ii887522::snake {
+
+// It is a view which reacts to the mouse only within a region.
+// See also ../View/HitGroup.h for more details
+struct HitTarget final {
+  SDL_Rect rect;
+  View* view;
+};
+
+}  // namespace ii887522::snake
+
+#endif
+#endif  // SNAKE_SRC_MAIN_STRUCT_HITTARGET_H_
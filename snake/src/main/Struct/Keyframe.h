@@ -0,0 +1,29 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_STRUCT_KEYFRAME_H_
+#define SNAKE_SRC_MAIN_STRUCT_KEYFRAME_H_
+
+#include <Struct/Point.h>
+#include <vector>
+#include "../Any/Enums.h"
+
+using std::vector;
+using ii887522::viewify::Point;
+
+namespace ii887522::snake {
+
+// It is a full snapshot of the simulation state at the end of a tick. Restoring it and re-simulating forward must reproduce
+// every tick after it.
+struct Keyframe final {
+  unsigned int tick;
+  unsigned int score;
+  Direction direction;
+  bool isDead;
+  bool hasFood;
+  Point<unsigned int> food;
+  vector<Point<unsigned int>> body;  // the first element is the head
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_STRUCT_KEYFRAME_H_
@@ -0,0 +1,15 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_STRUCT_KEYFRAMEINDEX_H_
+#define SNAKE_SRC_MAIN_STRUCT_KEYFRAMEINDEX_H_
+
+namespace ii887522::snake {
+
+struct KeyframeIndex final {
+  unsigned int tick;
+  unsigned long long offset;  // the position of the keyframe in the replay file
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_STRUCT_KEYFRAMEINDEX_H_
@@ -0,0 +1,35 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_STRUCT_LEVELHEADER_H_
+#define SNAKE_SRC_MAIN_STRUCT_LEVELHEADER_H_
+
+#include <Struct/Size.h>
+
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+// It is stored at the beginning of every level file. The file layout is:
+// header | wall bitmap | spawn points | food zones
+// The wall bitmap holds 1 bit per cell, which is set for a wall, in rows of wordsPerRow 64-bit words each. The cells on the border
+// are walls whatever their bits are. Every section is used straight from the file mapped into memory, so it is never parsed.
+// See also SpawnPoint.h and ../Any/Level.h for more details
+struct LevelHeader final {
+  static constexpr auto MAGIC{ 0x4c4b4e53u };  // "SNKL"
+  static constexpr auto VERSION{ 1u };
+
+  unsigned int magic;
+  unsigned int version;
+  Size<unsigned int> boardSize;  // including the border
+  unsigned int wordsPerRow;
+  unsigned int spawnPointCount;
+  unsigned int foodZoneCount;
+  unsigned int reserved;  // it keeps the offsets below aligned to 8 bytes
+  unsigned long long wallsOffset;  // the position of the first word of the wall bitmap in the file
+  unsigned long long spawnPointsOffset;  // the position of the first spawn point in the file
+  unsigned long long foodZonesOffset;  // the position of the first food zone in the file
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_STRUCT_LEVELHEADER_H_
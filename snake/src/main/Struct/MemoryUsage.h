@@ -0,0 +1,17 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_STRUCT_MEMORYUSAGE_H_
+#define SNAKE_SRC_MAIN_STRUCT_MEMORYUSAGE_H_
+
+namespace ii887522::snake {
+
+// It is an amount of memory. Both fields may go below 0 when it is the difference between 2 amounts.
+// See also ../Functions/accounting.h for more details
+struct MemoryUsage final {
+  long long bytes;
+  long long blockCount;
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_STRUCT_MEMORYUSAGE_H_
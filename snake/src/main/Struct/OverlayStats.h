@@ -0,0 +1,18 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_STRUCT_OVERLAYSTATS_H_
+#define SNAKE_SRC_MAIN_STRUCT_OVERLAYSTATS_H_
+
+namespace ii887522::snake {
+
+// It holds the game state shown by the performance overlay which the overlay cannot measure by itself.
+// See also ../View/PerfOverlay.h for more details
+struct OverlayStats final {
+  unsigned long long tickCount;  // the number of cells the snake has moved since the game started
+  unsigned int snakeLength;
+  unsigned long long lastSpawnDuration;  // how long the last food spawn took in microseconds
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_STRUCT_OVERLAYSTATS_H_
@@ -0,0 +1,24 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_STRUCT_REPLAYEVENT_H_
+#define SNAKE_SRC_MAIN_STRUCT_REPLAYEVENT_H_
+
+#include <Struct/Point.h>
+#include "../Any/Enums.h"
+
+using ii887522::viewify::Point;
+
+namespace ii887522::snake {
+
+// A DIRECTION event is applied before the tick it belongs to is simulated, whereas a FOOD event is applied after it. Food
+// positions are recorded rather than re-rolled so that a replay does not depend on the random number generator used by the game.
+struct ReplayEvent final {
+  unsigned int tick;
+  ReplayEventType type;
+  Direction direction;  // only meaningful for DIRECTION events
+  Point<unsigned int> position;  // only meaningful for FOOD events
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_STRUCT_REPLAYEVENT_H_
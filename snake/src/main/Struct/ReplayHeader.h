@@ -0,0 +1,31 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_STRUCT_REPLAYHEADER_H_
+#define SNAKE_SRC_MAIN_STRUCT_REPLAYHEADER_H_
+
+#include <Struct/Size.h>
+
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+// It is stored at the beginning of every replay file. The file layout is:
+// header | keyframes | events | keyframe index
+struct ReplayHeader final {
+  static constexpr auto MAGIC{ 0x524b4e53u };  // "SNKR"
+  static constexpr auto VERSION{ 1u };
+
+  unsigned int magic;
+  unsigned int version;
+  Size<unsigned int> boardSize;
+  unsigned int keyframeInterval;  // the number of ticks between 2 consecutive keyframes
+  unsigned int tickCount;
+  unsigned int eventCount;
+  unsigned int keyframeCount;
+  unsigned long long eventsOffset;  // the position of the first event in the file
+  unsigned long long indexOffset;  // the position of the first keyframe index entry in the file
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_STRUCT_REPLAYHEADER_H_
@@ -0,0 +1,31 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_STRUCT_SESSION_H_
+#define SNAKE_SRC_MAIN_STRUCT_SESSION_H_
+
+#include <winsock2.h>
+#include <vector>
+#include "../Any/Enums.h"
+#include "../Model/Simulation.h"
+
+using std::vector;
+
+namespace ii887522::snake {
+
+// It is 1 game hosted by a game server for 1 connected client. Sessions are reused after their clients disconnect, so the board,
+// the snake and the buffers keep the memory they have grown.
+// See also ../Any/GameServer.h for more details
+struct Session final {
+  SOCKET socket;
+  Simulation* simulation;
+  unsigned long long randomState;  // it spawns the foods of this session only
+  Direction direction;  // the direction the snake moves in the next tick
+  bool isPlaying;  // it is false while the snake is dead until the client restarts
+  bool isClosing;
+  vector<char> outbox;  // the bytes not sent yet
+  unsigned int outboxOffset;  // the number of bytes at the beginning of outbox which have been sent
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_STRUCT_SESSION_H_
@@ -0,0 +1,24 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_STRUCT_SESSIONEVENT_H_
+#define SNAKE_SRC_MAIN_STRUCT_SESSIONEVENT_H_
+
+#include <Struct/Point.h>
+
+using ii887522::viewify::Point;
+
+namespace ii887522::snake {
+
+// It is either a frame stepped or an input received by the app in a recorded session, in the order they happened.
+struct SessionEvent final {
+  static constexpr auto FRAME{ 0u };
+
+  unsigned int type;  // the SDL event type of an input, or FRAME
+  unsigned int time;  // in milliseconds since the session began on the clock of the frames stepped, including the frame if it is one
+  int code;  // the key code of a keyboard input or the button of a mouse button input
+  Point<int> position;  // the mouse position of a mouse input
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_STRUCT_SESSIONEVENT_H_
@@ -0,0 +1,22 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_STRUCT_SESSIONHEADER_H_
+#define SNAKE_SRC_MAIN_STRUCT_SESSIONHEADER_H_
+
+namespace ii887522::snake {
+
+// It is stored at the beginning of every session file. The file layout is:
+// header | events
+// See also SessionEvent.h for more details
+struct SessionHeader final {
+  static constexpr auto MAGIC{ 0x494b4e53u };  // "SNKI"
+  static constexpr auto VERSION{ 1u };
+
+  unsigned int magic;
+  unsigned int version;
+  unsigned long long seed;  // the seed the games of the session were played with
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_STRUCT_SESSIONHEADER_H_
@@ -0,0 +1,27 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_STRUCT_SHAREDSTATE_H_
+#define SNAKE_SRC_MAIN_STRUCT_SHAREDSTATE_H_
+
+#include <Struct/Point.h>
+
+using ii887522::viewify::Point;
+
+namespace ii887522::snake {
+
+// It is the state of a game at the end of a tick as published by StatePublisher, apart from the cells.
+// See also SharedStateSlot.h for more details
+struct SharedState final {
+  unsigned int tick;
+  unsigned int score;
+  unsigned int length;  // the number of cells of the snake
+  Point<unsigned int> head;
+  Point<unsigned int> tail;
+  Point<unsigned int> food;
+  bool hasFood;
+  bool isDead;
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_STRUCT_SHAREDSTATE_H_
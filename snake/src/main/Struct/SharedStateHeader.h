@@ -0,0 +1,31 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_STRUCT_SHAREDSTATEHEADER_H_
+#define SNAKE_SRC_MAIN_STRUCT_SHAREDSTATEHEADER_H_
+
+#include <Struct/Size.h>
+#include <atomic>
+
+using std::atomic;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+// It is stored at the beginning of the shared memory published by StatePublisher. The shared memory layout is:
+// header | slot 0 | slot 1 | ... | slot (slotCount - 1)
+// See also SharedStateSlot.h for more details
+struct SharedStateHeader final {
+  static constexpr auto MAGIC{ 0x534b4e53u };  // "SNKS"
+  static constexpr auto VERSION{ 1u };
+
+  unsigned int magic;
+  unsigned int version;
+  Size<unsigned int> boardSize;
+  unsigned int slotCount;
+  unsigned int slotSize;  // in bytes including the packed cells which follow each slot
+  atomic<unsigned long long> publishCount;  // the latest state is in slot (publishCount - 1) % slotCount if it is not 0
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_STRUCT_SHAREDSTATEHEADER_H_
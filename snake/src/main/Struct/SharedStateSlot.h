@@ -0,0 +1,24 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_STRUCT_SHAREDSTATESLOT_H_
+#define SNAKE_SRC_MAIN_STRUCT_SHAREDSTATESLOT_H_
+
+#include <atomic>
+#include "SharedState.h"
+
+using std::atomic;
+
+namespace ii887522::snake {
+
+// The cells follow each slot in row major order packed 2 per byte as CellType, the cell with the even x in the low 4 bits.
+//
+// The sequence is odd while the slot is being written. A reader copies the slot out between 2 loads of the sequence and keeps
+// the copy only if both loads see the same even number.
+struct SharedStateSlot final {
+  atomic<unsigned int> sequence;
+  SharedState state;
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_STRUCT_SHAREDSTATESLOT_H_
@@ -0,0 +1,22 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_STRUCT_SPAWNPOINT_H_
+#define SNAKE_SRC_MAIN_STRUCT_SPAWNPOINT_H_
+
+#include <Struct/Point.h>
+#include "../Any/Enums.h"
+
+using ii887522::viewify::Point;
+
+namespace ii887522::snake {
+
+// It is where a new snake may be born in a level and the way it heads at first.
+// See also LevelHeader.h for more details
+struct SpawnPoint final {
+  Point<unsigned int> position;
+  Direction direction;
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_STRUCT_SPAWNPOINT_H_
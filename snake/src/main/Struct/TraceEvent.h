@@ -0,0 +1,23 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_STRUCT_TRACEEVENT_H_
+#define SNAKE_SRC_MAIN_STRUCT_TRACEEVENT_H_
+
+namespace ii887522::snake {
+
+// It is an event of the Chrome trace event format. Names are copied into the event so that the strings they come from do not
+// need to outlive the flush.
+struct TraceEvent final {
+  static constexpr auto NAME_CAPACITY{ 40u };
+
+  char name[NAME_CAPACITY];
+  const char* category;  // it must point to a string literal
+  char phase;  // 'X' for a complete event or 'i' for an instant event
+  unsigned int threadId;
+  long long timestamp;  // in microseconds since tracing started
+  long long duration;  // in microseconds, only meaningful for complete events
+};
+
+}  // namespace ii887522::snake
+
+#endif  // SNAKE_SRC_MAIN_STRUCT_TRACEEVENT_H_
@@ -0,0 +1,124 @@
+// Copyright ii887522
+
+#ifndef TEST
+
+#include "ArenaView.h"
+#include <Any/View.h>
+#include <Any/Reactive.h>
+#include <Struct/Rect.h>
+#include <Struct/Point.h>
+#include <Struct/Color.h>
+#include <SDL.h>
+#include <cstdio>
+#include <algorithm>
+#include <chrono>  // NOLINT(build/c++11)
+#include "../Any/Enums.h"
+#include "../Any/GlyphAtlas.h"
+#include "../Model/Arena.h"
+#include "../Any/Canvas.h"
+#include "../Functions/trace.h"
+#include "BoardView.h"
+
+using std::snprintf;
+using std::min;
+using std::max;
+using std::chrono::high_resolution_clock;
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+using ii887522::viewify::View;
+using ii887522::nitro::Reactive;
+using ii887522::viewify::Rect;
+using ii887522::viewify::Point;
+using ii887522::viewify::Color;
+using ii887522::viewify::Action;
+
+namespace ii887522::snake {
+
+ArenaView::ArenaView(SDL_Renderer*const renderer, Arena*const arena, BoardView*const board, const GlyphAtlas& atlas,
+  const Rect<int>& headerRect, Reactive<Path>*const currentPath, const int cellSize, const unsigned int tickDuration) :
+  View{ renderer, headerRect.position }, arena{ *arena }, board{ *board }, atlas{ atlas }, headerRect{ headerRect },
+  currentPath{ *currentPath }, cellSize{ cellSize }, tickDuration{ tickDuration }, elapsed{ 0u }, focusIndex{ 0u },
+  lastTickDuration{ 0ull }, line{ } {
+  board->addLayer([this](Canvas& canvas, const Point<int>& origin, const SDL_Rect& clip) {
+    draw(&canvas, origin, clip);
+  });
+  if (arena->getSnakes().empty()) return;
+  focusNext(static_cast<unsigned int>(arena->getSnakes().size()) - 1u);
+  const auto& focus{ arena->getSnakes()[focusIndex] };
+  if (!focus.body.empty()) board->follow(static_cast<Point<float>>(focus.body.front()));
+}
+
+void ArenaView::draw(Canvas*const canvas, const Point<int>& origin, const SDL_Rect& clip) {
+  const auto& size{ arena.getCells().getSize() };
+  const auto left{ static_cast<unsigned int>(max((clip.x - origin.x) / cellSize, 0)) };
+  const auto top{ static_cast<unsigned int>(max((clip.y - origin.y) / cellSize, 0)) };
+  const auto right{ min(static_cast<unsigned int>(max((clip.x + clip.w - origin.x + cellSize - 1) / cellSize, 0)), size.w) };
+  const auto bottom{ min(static_cast<unsigned int>(max((clip.y + clip.h - origin.y + cellSize - 1) / cellSize, 0)), size.h) };
+  headRects.clear();
+  bodyRects.clear();
+  foodRects.clear();
+  for (auto y{ top }; y < bottom; ++y) {
+    for (auto x{ left }; x < right; ++x) {
+      const SDL_Rect rect{ origin.x + static_cast<int>(x) * cellSize, origin.y + static_cast<int>(y) * cellSize, cellSize, cellSize };
+      switch (arena.getCells().get(Point{ x, y })) {
+        case CellType::SNAKE_HEAD: headRects.push_back(rect);
+          break;
+        case CellType::SNAKE_BODY: bodyRects.push_back(rect);
+          break;
+        case CellType::FOOD: foodRects.push_back(rect);
+      }
+    }
+  }
+  canvas->fillRects(headRects.data(), static_cast<int>(headRects.size()), Color{ 0u, 255u, 0u });
+  canvas->fillRects(bodyRects.data(), static_cast<int>(bodyRects.size()), Color{ 0u, 160u, 0u });
+  canvas->fillRects(foodRects.data(), static_cast<int>(foodRects.size()), Color{ 255u, 255u, 0u });
+}
+
+void ArenaView::focusNext(const unsigned int index) {
+  const auto& snakes{ arena.getSnakes() };
+  for (auto i{ 1u }; i <= snakes.size(); ++i) {
+    const auto nextIndex{ static_cast<unsigned int>((index + i) % snakes.size()) };
+    if (snakes[nextIndex].body.empty()) continue;
+    focusIndex = nextIndex;
+    return;
+  }
+}
+
+Action ArenaView::reactKeyDown(const SDL_KeyboardEvent& keyEvent) {
+  switch (keyEvent.keysym.sym) {
+    case SDLK_ESCAPE: currentPath.set(Path::MAIN);
+      break;
+    case SDLK_TAB: focusNext(focusIndex);
+  }
+  return Action::QUIT;
+}
+
+void ArenaView::step(const unsigned int dt) {
+  if (currentPath.get() != Path::ARENA) return;
+  elapsed += dt;
+  if (elapsed < tickDuration) return;
+  elapsed = min(elapsed - tickDuration, tickDuration);  // skip ticks rather than spiral when a tick takes too long
+  const auto begin{ high_resolution_clock::now() };
+  arena.step();
+  const auto end{ high_resolution_clock::now() };
+  traceComplete("Arena::step", "simulation", begin, end);
+  lastTickDuration = duration_cast<microseconds>(end - begin).count();
+  if (arena.getSnakes().empty()) return;
+  if (arena.getSnakes()[focusIndex].body.empty()) focusNext(focusIndex);
+  const auto& focus{ arena.getSnakes()[focusIndex] };
+  if (!focus.body.empty()) board.follow(static_cast<Point<float>>(focus.body.front()));
+  // Most cells seen change in every tick when there are many snakes, so the whole viewport is redrawn
+  const auto& size{ arena.getCells().getSize() };
+  board.damage(SDL_Rect{ 0, 0, static_cast<int>(size.w) * cellSize, static_cast<int>(size.h) * cellSize });
+}
+
+void ArenaView::render() {
+  snprintf(line, LINE_CAPACITY, "tick %u  alive %u/%u  deaths %llu  step %llu us", arena.getTick(), arena.getAliveCount(),
+    static_cast<unsigned int>(arena.getSnakes().size()), arena.getDeathCount(), lastTickDuration);
+  atlas.render(Point{ headerRect.position.x + 8, headerRect.position.y + ((headerRect.size.h - atlas.getLineHeight()) >> 1u) }, line,
+    Color{ 255u, 255u, 255u });
+}
+
+}  // namespace ii887522::snake
+
+#endif
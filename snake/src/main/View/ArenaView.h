@@ -0,0 +1,83 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_VIEW_ARENAVIEW_H_
+#define SNAKE_SRC_MAIN_VIEW_ARENAVIEW_H_
+
+#ifndef TEST
+
+#include <Any/View.h>
+#include <Any/Reactive.h>
+#include <Struct/Rect.h>
+#include <Struct/Point.h>
+#include <SDL.h>
+#include <vector>
+#include "../Any/Enums.h"
+#include "../Any/GlyphAtlas.h"
+#include "../Model/Arena.h"
+#include "../Any/Canvas.h"
+#include "BoardView.h"
+
+using std::vector;
+using ii887522::viewify::View;
+using ii887522::nitro::Reactive;
+using ii887522::viewify::Rect;
+using ii887522::viewify::Point;
+using ii887522::viewify::Action;
+
+namespace ii887522::snake {
+
+// It plays an arena on a board and shows how it is going in the header band. Only the cells inside the region being redrawn are
+// looked at, so drawing costs the same no matter how large the arena is. The camera follows 1 of the snakes alive, Tab follows the
+// next one and Escape goes back to the main page.
+// Not Thread Safe: it must only be used in main thread
+// See also ../Model/Arena.h for more details
+class ArenaView final : public View {
+  // remove copy semantics
+  ArenaView(const ArenaView&) = delete;
+  ArenaView& operator=(const ArenaView&) = delete;
+
+  // remove move semantics
+  ArenaView(ArenaView&&) = delete;
+  ArenaView& operator=(ArenaView&&) = delete;
+
+  static constexpr auto LINE_CAPACITY{ 96u };
+
+  Arena& arena;
+  BoardView& board;
+  const GlyphAtlas& atlas;
+  const Rect<int> headerRect;
+  Reactive<Path>& currentPath;
+  const int cellSize;
+  const unsigned int tickDuration;
+  unsigned int elapsed;  // the time since the last tick
+  unsigned int focusIndex;  // the index of the snake followed by the camera
+  unsigned long long lastTickDuration;  // how long the last tick took in microseconds
+  vector<SDL_Rect> headRects;  // They are kept between frames so that drawing does not allocate
+  vector<SDL_Rect> bodyRects;
+  vector<SDL_Rect> foodRects;
+  char line[LINE_CAPACITY];
+
+  // Param origin: where the top left corner of the board is drawn in the canvas
+  // Param clip: the region to redraw relative to the canvas
+  void draw(Canvas*const, const Point<int>& origin, const SDL_Rect& clip);
+
+  // Moves the focus to the next snake alive after the snake given, or keeps it if every snake is dead.
+  void focusNext(const unsigned int index);
+
+ public:
+  // Param renderer: it must not be assigned to integer
+  // Param board: the arena is drawn as a layer of it
+  // Param headerRect: the header band to show the stats in
+  // Param tickDuration: the time between ticks in milliseconds
+  explicit ArenaView(SDL_Renderer*const renderer, Arena*const arena, BoardView*const board, const GlyphAtlas&,
+    const Rect<int>& headerRect, Reactive<Path>*const currentPath, const int cellSize, const unsigned int tickDuration);
+
+  Action reactKeyDown(const SDL_KeyboardEvent&) override;
+  void step(const unsigned int dt) override;
+  void render() override;
+};
+
+}  // namespace ii887522::snake
+
+#endif
+#endif  // SNAKE_SRC_MAIN_VIEW_ARENAVIEW_H_
@@ -0,0 +1,23 @@
+// Copyright ii887522
+
+#ifndef TEST
+
+#include "AssetUploadView.h"
+#include <Any/View.h>
+#include <SDL.h>
+#include "../Any/AssetLoader.h"
+
+using ii887522::viewify::View;
+
+namespace ii887522::snake {
+
+AssetUploadView::AssetUploadView(SDL_Renderer*const renderer, AssetLoader*const loader, const unsigned int uploadCountPerFrame) :
+  View{ renderer }, loader{ *loader }, uploadCountPerFrame{ uploadCountPerFrame } { }
+
+void AssetUploadView::step(const unsigned int) {
+  loader.upload(uploadCountPerFrame);
+}
+
+}  // namespace ii887522::snake
+
+#endif
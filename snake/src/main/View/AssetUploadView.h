@@ -0,0 +1,41 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_VIEW_ASSETUPLOADVIEW_H_
+#define SNAKE_SRC_MAIN_VIEW_ASSETUPLOADVIEW_H_
+
+#ifndef TEST
+
+#include <Any/View.h>
+#include <SDL.h>
+#include "../Any/AssetLoader.h"
+
+using ii887522::viewify::View;
+
+namespace ii887522::snake {
+
+// It is an invisible view which uploads a few assets loaded by the asset loader given every frame.
+// Not Thread Safe: it must only be used in main thread
+// See also ../Any/AssetLoader.h for more details
+class AssetUploadView final : public View {
+  // remove copy semantics
+  AssetUploadView(const AssetUploadView&) = delete;
+  AssetUploadView& operator=(const AssetUploadView&) = delete;
+
+  // remove move semantics
+  AssetUploadView(AssetUploadView&&) = delete;
+  AssetUploadView& operator=(AssetUploadView&&) = delete;
+
+  AssetLoader& loader;
+  const unsigned int uploadCountPerFrame;
+
+ public:
+  // Param renderer: it must not be assigned to integer
+  explicit AssetUploadView(SDL_Renderer*const renderer, AssetLoader*const loader, const unsigned int uploadCountPerFrame = 1u);
+
+  void step(const unsigned int dt) override;
+};
+
+}  // namespace ii887522::snake
+
+#endif
+#endif  // SNAKE_SRC_MAIN_VIEW_ASSETUPLOADVIEW_H_
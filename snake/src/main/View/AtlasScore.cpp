@@ -0,0 +1,53 @@
+// Copyright ii887522
+
+#ifndef TEST
+
+#include "AtlasScore.h"
+#include <Any/View.h>
+#include <Any/Reactive.h>
+#include <Struct/Point.h>
+#include <SDL.h>
+#include <cstdio>
+#include "../Any/GlyphAtlas.h"
+#include "../Any/Enums.h"
+#include "../Any/MemoryScope.h"
+#include "../Functions/accounting.h"
+
+using std::snprintf;
+using ii887522::viewify::View;
+using ii887522::nitro::Reactive;
+using ii887522::viewify::Point;
+
+namespace ii887522::snake {
+
+AtlasScore::AtlasScore(const Builder& builder) : View{ builder.renderer, builder.position }, atlas{ builder.atlas },
+  color{ builder.color }, max{ builder.max }, onMax{ builder.onMax }, value{ 0u }, text{ },
+  watcherUsage{ 0ll, 0ll } {
+  watchTracked(builder.canIncrement, [this](const bool& canIncrement, const int) {
+    if (!canIncrement) return;
+    set(value + 1u);
+    if (value == max) onMax();
+  }, &watcherUsage);
+  watchTracked(builder.canReset, [this](const bool& canReset, const int) {
+    if (canReset) set(0u);
+  }, &watcherUsage);
+  set(0u);
+}
+
+void AtlasScore::set(const unsigned int p_value) {
+  value = p_value;
+  snprintf(text, TEXT_CAPACITY, "%u", value);
+}
+
+void AtlasScore::render() {
+  // The width is measured here because it changes once the atlas is uploaded
+  atlas.render(Point{ getPosition().get().x - (atlas.getWidth(text) >> 1u), getPosition().get().y }, text, color);
+}
+
+AtlasScore::~AtlasScore() {
+  trackFree(MemoryCategory::REACTIVE_WATCHERS, watcherUsage);
+}
+
+}  // namespace ii887522::snake
+
+#endif
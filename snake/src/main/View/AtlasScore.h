@@ -0,0 +1,118 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_VIEW_ATLASSCORE_H_
+#define SNAKE_SRC_MAIN_VIEW_ATLASSCORE_H_
+
+#ifndef TEST
+
+#include <Any/View.h>
+#include <Any/Reactive.h>
+#include <Struct/Point.h>
+#include <Struct/Color.h>
+#include <SDL.h>
+#include <functional>
+#include <stdexcept>
+#include "../Any/GlyphAtlas.h"
+#include "../Struct/MemoryUsage.h"
+
+using std::function;
+using std::runtime_error;
+using ii887522::viewify::View;
+using ii887522::nitro::Reactive;
+using ii887522::viewify::Point;
+using ii887522::viewify::Color;
+
+namespace ii887522::snake {
+
+// It is a score counter drawn from a shared glyph atlas. Changing the score only reformats a few digits into a fixed buffer, so it
+// never rasterizes text nor creates a texture.
+// Not Thread Safe: it must only be used in main thread
+// See also ../Any/GlyphAtlas.h for more details
+class AtlasScore final : public View {
+  // remove copy semantics
+  AtlasScore(const AtlasScore&) = delete;
+  AtlasScore& operator=(const AtlasScore&) = delete;
+
+  // remove move semantics
+  AtlasScore(AtlasScore&&) = delete;
+  AtlasScore& operator=(AtlasScore&&) = delete;
+
+ public:
+  // Not Thread Safe
+  class Builder final {
+    // remove copy semantics
+    Builder(const Builder&) = delete;
+    Builder& operator=(const Builder&) = delete;
+
+    // remove move semantics
+    Builder(Builder&&) = delete;
+    Builder& operator=(Builder&&) = delete;
+
+    SDL_Renderer*const renderer;
+    const GlyphAtlas& atlas;
+    const Point<int> position;
+    const Color<unsigned int> color;
+    const unsigned int max;
+    const function<void()> onMax;
+    Reactive<bool>* canIncrement;
+    bool hasSetCanIncrement;
+    Reactive<bool>* canReset;
+    bool hasSetCanReset;
+
+   public:
+    // Param renderer: it must not be assigned to integer
+    // Param position: the top center of the score
+    // Param onMax: it is called when the score reaches max
+    explicit Builder(SDL_Renderer*const renderer, const GlyphAtlas& atlas, const Point<int>& position, const Color<unsigned int>& color,
+      const unsigned int max, const function<void()>& onMax) : renderer{ renderer }, atlas{ atlas }, position{ position },
+      color{ color }, max{ max }, onMax{ onMax }, canIncrement{ nullptr }, hasSetCanIncrement{ false }, canReset{ nullptr },
+      hasSetCanReset{ false } { }
+
+    // Param value: the score is incremented whenever it becomes true
+    // Must Call Time(s): At least 1
+    constexpr Builder& setCanIncrement(Reactive<bool>*const value) {
+      canIncrement = value;
+      hasSetCanIncrement = true;
+      return *this;
+    }
+
+    // Param value: the score is reset to 0 whenever it becomes true
+    // Must Call Time(s): At least 1
+    constexpr Builder& setCanReset(Reactive<bool>*const value) {
+      canReset = value;
+      hasSetCanReset = true;
+      return *this;
+    }
+
+    AtlasScore* build() {
+      if (!hasSetCanIncrement) throw runtime_error{ "AtlasScore canIncrement is required!" };
+      if (!hasSetCanReset) throw runtime_error{ "AtlasScore canReset is required!" };
+      return new AtlasScore{ *this };
+    }
+
+    friend class AtlasScore;
+  };
+
+ private:
+  static constexpr auto TEXT_CAPACITY{ 16u };
+
+  const GlyphAtlas& atlas;
+  const Color<unsigned int> color;
+  const unsigned int max;
+  const function<void()> onMax;
+  unsigned int value;
+  char text[TEXT_CAPACITY];
+  MemoryUsage watcherUsage;
+
+  explicit AtlasScore(const Builder&);
+  void set(const unsigned int value);
+
+ public:
+  void render() override;
+  ~AtlasScore();
+};
+
+}  // namespace ii887522::snake
+
+#endif
+#endif  // SNAKE_SRC_MAIN_VIEW_ATLASSCORE_H_
@@ -0,0 +1,29 @@
+// Copyright ii887522
+
+#ifndef TEST
+
+#include "AtlasText.h"
+#include <Any/View.h>
+#include <Struct/Point.h>
+#include <Struct/Color.h>
+#include <SDL.h>
+#include <string>
+#include "../Any/GlyphAtlas.h"
+
+using std::string;
+using ii887522::viewify::View;
+using ii887522::viewify::Point;
+using ii887522::viewify::Color;
+
+namespace ii887522::snake {
+
+AtlasText::AtlasText(SDL_Renderer*const renderer, const GlyphAtlas& atlas, const Point<int>& position, const string& text,
+  const Color<unsigned int>& color) : View{ renderer, position }, atlas{ atlas }, text{ text }, color{ color } { }
+
+void AtlasText::render() {
+  atlas.render(getPosition().get(), text.c_str(), color);
+}
+
+}  // namespace ii887522::snake
+
+#endif
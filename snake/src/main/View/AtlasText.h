@@ -0,0 +1,50 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_VIEW_ATLASTEXT_H_
+#define SNAKE_SRC_MAIN_VIEW_ATLASTEXT_H_
+
+#ifndef TEST
+
+#include <Any/View.h>
+#include <Struct/Point.h>
+#include <Struct/Color.h>
+#include <SDL.h>
+#include <string>
+#include "../Any/GlyphAtlas.h"
+
+using std::string;
+using ii887522::viewify::View;
+using ii887522::viewify::Point;
+using ii887522::viewify::Color;
+
+namespace ii887522::snake {
+
+// It is a static label drawn from a shared glyph atlas, so it owns no texture.
+// Not Thread Safe: it must only be used in main thread
+// See also ../Any/GlyphAtlas.h for more details
+class AtlasText final : public View {
+  // remove copy semantics
+  AtlasText(const AtlasText&) = delete;
+  AtlasText& operator=(const AtlasText&) = delete;
+
+  // remove move semantics
+  AtlasText(AtlasText&&) = delete;
+  AtlasText& operator=(AtlasText&&) = delete;
+
+  const GlyphAtlas& atlas;
+  const string text;
+  const Color<unsigned int> color;
+
+ public:
+  // Param renderer: it must not be assigned to integer
+  // Param position: the top left corner of the text
+  explicit AtlasText(SDL_Renderer*const renderer, const GlyphAtlas&, const Point<int>& position, const string& text,
+    const Color<unsigned int>& color = Color{ 0u, 0u, 0u });
+
+  void render() override;
+};
+
+}  // namespace ii887522::snake
+
+#endif
+#endif  // SNAKE_SRC_MAIN_VIEW_ATLASTEXT_H_
@@ -0,0 +1,213 @@
+// Copyright ii887522
+
+#ifndef TEST
+
+#include "BoardView.h"
+#include <Any/View.h>
+#include <Struct/Rect.h>
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <Struct/Color.h>
+#include <SDL.h>
+#include <functional>
+#include <algorithm>
+#include "../Any/Enums.h"
+#include "../Any/DamageTracker.h"
+#include "../Any/FrameProfiler.h"
+#include "../Any/Canvas.h"
+#include "../Any/Level.h"
+#include "../Functions/accounting.h"
+#include "../Functions/event_ext.h"
+
+using std::function;
+using std::min;
+using std::max;
+using ii887522::viewify::View;
+using ii887522::viewify::Rect;
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+using ii887522::viewify::Color;
+
+namespace ii887522::snake {
+
+BoardView::BoardView(SDL_Renderer*const renderer, const Rect<int>& viewport, const Size<unsigned int>& boardSize, const int cellSize,
+  FrameProfiler*const profiler, const RenderBackend backend, const Level*const level) : View{ renderer, viewport.position },
+  viewport{ viewport }, boardSize{ static_cast<int>(boardSize.w) * cellSize, static_cast<int>(boardSize.h) * cellSize },
+  cellSize{ cellSize }, profiler{ profiler }, level{ level }, camera{ clampCamera(Point{ 0, 0 }) }, backBuffer{ nullptr },
+  isBackBufferSupported{ true }, renderTargetResetCount{ getRenderTargetResetCount() },
+  renderDeviceResetCount{ getRenderDeviceResetCount() }, backSurface{
+    backend == RenderBackend::SOFTWARE ?
+      SDL_CreateRGBSurfaceWithFormat(0u, viewport.size.w, viewport.size.h, 32, SDL_PIXELFORMAT_ARGB8888) : nullptr
+  }, canvas{ renderer, backSurface } {
+  if (backSurface) trackAllocation(MemoryCategory::BOARD_TEXTURES, getSurfaceUsage(backSurface));
+}
+
+Point<int> BoardView::clampCamera(const Point<int>& position) const {
+  return Point{
+    boardSize.w <= viewport.size.w ? (boardSize.w - viewport.size.w) / 2 : min(max(position.x, 0), boardSize.w - viewport.size.w),
+    boardSize.h <= viewport.size.h ? (boardSize.h - viewport.size.h) / 2 : min(max(position.y, 0), boardSize.h - viewport.size.h)
+  };
+}
+
+void BoardView::addLayer(const function<void(Canvas& canvas, const Point<int>& origin, const SDL_Rect& clip)>& draw) {
+  layers.push_back(draw);
+  damageTracker.damageAll();
+}
+
+void BoardView::damage(const SDL_Rect& rect) {
+  const SDL_Rect viewportRect{ 0, 0, viewport.size.w, viewport.size.h };
+  const SDL_Rect cameraRect{ rect.x - camera.x, rect.y - camera.y, rect.w, rect.h };
+  SDL_Rect visibleRect;
+  if (SDL_IntersectRect(&cameraRect, &viewportRect, &visibleRect)) damageTracker.damage(visibleRect);
+}
+
+void BoardView::follow(const Point<float>& position) {
+  const auto x{ static_cast<int>(position.x * cellSize) + (cellSize >> 1u) };
+  const auto y{ static_cast<int>(position.y * cellSize) + (cellSize >> 1u) };
+  const auto left{ viewport.size.w >> 2u };
+  const auto top{ viewport.size.h >> 2u };
+  const auto right{ viewport.size.w - left };
+  const auto bottom{ viewport.size.h - top };
+  const auto nextCamera{ clampCamera(Point{
+    x < camera.x + left ? x - left : x > camera.x + right ? x - right : camera.x,
+    y < camera.y + top ? y - top : y > camera.y + bottom ? y - bottom : camera.y
+  }) };
+  if (nextCamera.x == camera.x && nextCamera.y == camera.y) return;
+  camera = nextCamera;
+  damageTracker.damageAll();
+}
+
+void BoardView::findLevelWalls(const Point<int>& origin, const SDL_Rect& clip) {
+  levelWalls.clear();
+  // Only the cells inside the border and the region are visited, so a huge maze costs no more than a small one
+  const auto left{ max((clip.x - origin.x) / cellSize, 1) };
+  const auto top{ max((clip.y - origin.y) / cellSize, 1) };
+  const auto right{ min((clip.x + clip.w - 1 - origin.x) / cellSize, boardSize.w / cellSize - 2) };
+  const auto bottom{ min((clip.y + clip.h - 1 - origin.y) / cellSize, boardSize.h / cellSize - 2) };
+  for (auto y{ top }; y <= bottom; ++y) {
+    for (auto x{ left }; x <= right; ++x) {
+      if (!level->isWall(Point{ static_cast<unsigned int>(x), static_cast<unsigned int>(y) })) continue;
+      const auto begin{ x };
+      while (x + 1 <= right && level->isWall(Point{ static_cast<unsigned int>(x + 1), static_cast<unsigned int>(y) })) ++x;
+      levelWalls.push_back(SDL_Rect{ origin.x + begin * cellSize, origin.y + y * cellSize, (x - begin + 1) * cellSize, cellSize });
+    }
+  }
+}
+
+void BoardView::draw(const Point<int>& origin, const SDL_Rect& clip) {
+  canvas.setClip(clip);
+  canvas.fillRect(clip, Color{ 0u, 0u, 0u });
+  if (profiler) profiler->countDrawCalls(1u);
+  // Only the parts of the walls inside the region are drawn, so a huge board costs no more than a small one
+  const SDL_Rect walls[]{
+    SDL_Rect{ origin.x, origin.y, boardSize.w, cellSize },
+    SDL_Rect{ origin.x, origin.y + boardSize.h - cellSize, boardSize.w, cellSize },
+    SDL_Rect{ origin.x, origin.y + cellSize, cellSize, boardSize.h - (cellSize << 1u) },
+    SDL_Rect{ origin.x + boardSize.w - cellSize, origin.y + cellSize, cellSize, boardSize.h - (cellSize << 1u) }
+  };
+  SDL_Rect visibleWalls[4u];
+  auto visibleWallCount{ 0 };
+  for (const auto& wall : walls) {
+    if (SDL_IntersectRect(&wall, &clip, &visibleWalls[visibleWallCount])) ++visibleWallCount;
+  }
+  if (visibleWallCount != 0) {
+    canvas.fillRects(visibleWalls, visibleWallCount, Color{ 255u, 0u, 0u });
+    if (profiler) profiler->countDrawCalls(1u);
+  }
+  if (level) findLevelWalls(origin, clip);
+  if (!levelWalls.empty()) {
+    canvas.fillRects(levelWalls.data(), static_cast<int>(levelWalls.size()), Color{ 255u, 0u, 0u });
+    if (profiler) profiler->countDrawCalls(1u);
+  }
+  for (const auto& layer : layers) layer(canvas, origin, clip);
+  canvas.clearClip();
+}
+
+void BoardView::checkRenderResets() {
+  if (renderDeviceResetCount != getRenderDeviceResetCount()) {
+    renderDeviceResetCount = getRenderDeviceResetCount();
+    // It is recreated and redrawn as a whole before it is drawn with
+    if (backBuffer) {
+      trackFree(MemoryCategory::BOARD_TEXTURES, getTextureUsage(backBuffer));
+      SDL_DestroyTexture(backBuffer);
+      backBuffer = nullptr;
+    }
+  }
+  if (renderTargetResetCount != getRenderTargetResetCount()) {
+    renderTargetResetCount = getRenderTargetResetCount();
+    damageTracker.damageAll();
+  }
+}
+
+void BoardView::renderSoftware() {
+  if (!backBuffer) {
+    backBuffer = SDL_CreateTexture(getRenderer(), SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, viewport.size.w, viewport.size.h);
+    trackAllocation(MemoryCategory::BOARD_TEXTURES, getTextureUsage(backBuffer));
+    damageTracker.damageAll();
+  }
+  if (damageTracker.isDamaged()) {
+    const auto origin{ Point{ -camera.x, -camera.y } };
+    const SDL_Rect allRect{ 0, 0, viewport.size.w, viewport.size.h };
+    const auto rectCount{ damageTracker.isAllDamaged() ? 1u : static_cast<unsigned int>(damageTracker.getRects().size()) };
+    for (auto i{ 0u }; i != rectCount; ++i) {
+      const auto& rect{ damageTracker.isAllDamaged() ? allRect : damageTracker.getRects()[i] };
+      draw(origin, rect);
+      // Only the pixels redrawn are uploaded
+      SDL_UpdateTexture(backBuffer, &rect, static_cast<Uint8*>(backSurface->pixels) + rect.y * backSurface->pitch + (rect.x << 2u),
+        backSurface->pitch);
+    }
+    damageTracker.clear();
+  }
+  const SDL_Rect destinationRect{ viewport.position.x, viewport.position.y, viewport.size.w, viewport.size.h };
+  SDL_RenderCopy(getRenderer(), backBuffer, nullptr, &destinationRect);
+  if (profiler) profiler->countDrawCalls(1u);
+}
+
+void BoardView::render() {
+  checkRenderResets();
+  if (backSurface) {
+    renderSoftware();
+    return;
+  }
+  if (isBackBufferSupported && !backBuffer) {
+    backBuffer = SDL_CreateTexture(getRenderer(), SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, viewport.size.w, viewport.size.h);
+    isBackBufferSupported = backBuffer;
+    if (backBuffer) trackAllocation(MemoryCategory::BOARD_TEXTURES, getTextureUsage(backBuffer));
+    damageTracker.damageAll();
+  }
+  if (!isBackBufferSupported) {
+    draw(Point{ viewport.position.x - camera.x, viewport.position.y - camera.y }, SDL_Rect{ viewport.position.x, viewport.position.y, viewport.size.w, viewport.size.h });
+    damageTracker.clear();
+    return;
+  }
+  if (damageTracker.isDamaged()) {
+    const auto prevTarget{ SDL_GetRenderTarget(getRenderer()) };
+    SDL_SetRenderTarget(getRenderer(), backBuffer);
+    const auto origin{ Point{ -camera.x, -camera.y } };
+    if (damageTracker.isAllDamaged()) {
+      draw(origin, SDL_Rect{ 0, 0, viewport.size.w, viewport.size.h });
+    } else {
+      for (const auto& rect : damageTracker.getRects()) draw(origin, rect);
+    }
+    SDL_SetRenderTarget(getRenderer(), prevTarget);
+    damageTracker.clear();
+  }
+  const SDL_Rect destinationRect{ viewport.position.x, viewport.position.y, viewport.size.w, viewport.size.h };
+  SDL_RenderCopy(getRenderer(), backBuffer, nullptr, &destinationRect);
+  if (profiler) profiler->countDrawCalls(1u);
+}
+
+BoardView::~BoardView() {
+  if (backSurface) {
+    trackFree(MemoryCategory::BOARD_TEXTURES, getSurfaceUsage(backSurface));
+    SDL_FreeSurface(backSurface);
+  }
+  if (backBuffer) {
+    trackFree(MemoryCategory::BOARD_TEXTURES, getTextureUsage(backBuffer));
+    SDL_DestroyTexture(backBuffer);
+  }
+}
+
+}  // namespace ii887522::snake
+
+#endif
@@ -0,0 +1,109 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_VIEW_BOARDVIEW_H_
+#define SNAKE_SRC_MAIN_VIEW_BOARDVIEW_H_
+
+#ifndef TEST
+
+#include <Any/View.h>
+#include <Struct/Rect.h>
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <SDL.h>
+#include <functional>
+#include <vector>
+#include "../Any/Enums.h"
+#include "../Any/DamageTracker.h"
+#include "../Any/FrameProfiler.h"
+#include "../Any/Canvas.h"
+#include "../Any/Level.h"
+
+using std::function;
+using std::vector;
+using ii887522::viewify::View;
+using ii887522::viewify::Rect;
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+// It shows the part of a board seen by a camera inside a viewport on the screen. The board may be much larger than the viewport,
+// in which case the camera follows the snake head around. The walls and every layer added are drawn into a persistent back buffer,
+// but only the regions damaged since the last frame are redrawn, then the back buffer is copied onto the screen. Views drawn on
+// the board add themselves as layers and report the regions they change instead of drawing onto the screen directly. If the
+// renderer does not support render targets, the visible part of the board is drawn onto the screen every frame instead. With the
+// software backend, the back buffer is a surface filled by the CPU directly and only the damaged regions are uploaded to the
+// screen, which is much cheaper than going through a renderer which has no GPU behind it.
+// Not Thread Safe: it must only be used in main thread
+// See also ../Any/DamageTracker.h for more details
+class BoardView final : public View {
+  // remove copy semantics
+  BoardView(const BoardView&) = delete;
+  BoardView& operator=(const BoardView&) = delete;
+
+  // remove move semantics
+  BoardView(BoardView&&) = delete;
+  BoardView& operator=(BoardView&&) = delete;
+
+  const Rect<int> viewport;
+  const Size<int> boardSize;  // in pixels
+  const int cellSize;
+  FrameProfiler*const profiler;
+  const Level*const level;  // it is nullptr if the board only has the border as walls
+  vector<SDL_Rect> levelWalls;  // the runs of walls of the level being redrawn
+  DamageTracker damageTracker;
+  vector<function<void(Canvas& canvas, const Point<int>& origin, const SDL_Rect& clip)>> layers;
+  Point<int> camera;  // the board position in pixels at the top left corner of the viewport
+  SDL_Texture* backBuffer;
+  bool isBackBufferSupported;
+  unsigned int renderTargetResetCount;  // the count last seen, see also ../Functions/event_ext.h for more details
+  unsigned int renderDeviceResetCount;  // the count last seen, see also ../Functions/event_ext.h for more details
+  SDL_Surface*const backSurface;  // it is only used by the software backend, the back buffer is a copy of it
+  Canvas canvas;
+
+  // Return: the camera position given moved so that the viewport stays inside the board, or the board centered in the viewport if
+  // it is smaller
+  Point<int> clampCamera(const Point<int>&) const;
+
+  // Collects the runs of walls of the level within the region given into levelWalls.
+  // Param origin: where the top left corner of the board is drawn in the canvas
+  // Param clip: the region to redraw relative to the canvas
+  void findLevelWalls(const Point<int>& origin, const SDL_Rect& clip);
+
+  // Param origin: where the top left corner of the board is drawn in the canvas
+  // Param clip: the region to redraw relative to the canvas
+  void draw(const Point<int>& origin, const SDL_Rect& clip);
+
+  // Redraws the whole back buffer if the render targets have been reset, and recreates it if the render device has been reset.
+  void checkRenderResets();
+
+  void renderSoftware();
+
+ public:
+  // Param renderer: it must not be assigned to integer
+  // Param viewport: where the board is shown on the screen
+  // Param boardSize: the number of cells on each side of the board including the walls
+  // Param profiler: draw calls made by the board are counted into it if it is not nullptr
+  // Param backend: how the back buffer is drawn
+  // Param level: if it is not nullptr, its walls are drawn as well. It must have the board size given.
+  explicit BoardView(SDL_Renderer*const renderer, const Rect<int>& viewport, const Size<unsigned int>& boardSize, const int cellSize,
+    FrameProfiler*const profiler = nullptr, const RenderBackend backend = RenderBackend::RENDERER, const Level*const level = nullptr);
+
+  // Param draw: it draws a layer on top of the layers added before into the canvas given. It is called with where the top left
+  // corner of the board is in the canvas and the region being redrawn, so it can skip drawing outside the region.
+  void addLayer(const function<void(Canvas& canvas, const Point<int>& origin, const SDL_Rect& clip)>& draw);
+
+  // Param rect: the region changed relative to the top left corner of the board
+  void damage(const SDL_Rect& rect);
+
+  // Moves the camera just enough to keep the cell position given within the middle half of the viewport.
+  void follow(const Point<float>& position);
+
+  void render() override;
+  ~BoardView();
+};
+
+}  // namespace ii887522::snake
+
+#endif
+#endif  // SNAKE_SRC_MAIN_VIEW_BOARDVIEW_H_
@@ -0,0 +1,173 @@
+// Copyright ii887522
+
+#ifndef TEST
+
+#include "FadeModal.h"
+#include <Any/View.h>
+#include <Any/Reactive.h>
+#include <Struct/Point.h>
+#include <Struct/Paint.h>
+#include <SDL.h>
+#include <initializer_list>
+#include <algorithm>
+#include "../Any/Enums.h"
+#include "../Any/FrameProfiler.h"
+#include "../Functions/accounting.h"
+#include "../Functions/event_ext.h"
+#include "HitGroup.h"
+
+using std::initializer_list;
+using std::min;
+using ii887522::viewify::View;
+using ii887522::viewify::Action;
+using ii887522::viewify::Point;
+using ii887522::viewify::Paint;
+using ii887522::nitro::Reactive;
+
+namespace ii887522::snake {
+
+FadeModal::FadeModal(SDL_Renderer*const renderer, const Point<int>& position, const Paint<int, unsigned int>& background,
+  Reactive<bool>*const isShowing, const unsigned int fadeDuration, const unsigned int inputDirtyDuration,
+  FrameProfiler*const profiler, const HitGroup*const buttons, const initializer_list<View*>& views) : View{ renderer, position },
+  position{ position }, background{ background }, isShowing{ *isShowing }, fadeDuration{ fadeDuration },
+  inputDirtyDuration{ inputDirtyDuration }, profiler{ profiler }, buttons{ *buttons }, views{ views }, composite{ nullptr },
+  isCompositeSupported{ true }, a{ 0u }, dirtyDuration{ 0u }, isStale{ true },
+  renderTargetResetCount{ getRenderTargetResetCount() }, renderDeviceResetCount{ getRenderDeviceResetCount() } { }
+
+Action FadeModal::reactKeyDown(const SDL_KeyboardEvent& keyEvent) {
+  if (!isShowing.get()) return Action::NONE;
+  for (const auto view : views) {
+    if (view->reactKeyDown(keyEvent) == Action::QUIT) return Action::QUIT;
+  }
+  return Action::NONE;
+}
+
+Action FadeModal::reactKeyUp(const SDL_KeyboardEvent& keyEvent) {
+  if (!isShowing.get()) return Action::NONE;
+  for (const auto view : views) {
+    if (view->reactKeyUp(keyEvent) == Action::QUIT) return Action::QUIT;
+  }
+  return Action::NONE;
+}
+
+void FadeModal::reactMouseMotion(const SDL_MouseMotionEvent& motionEvent) {
+  if (!isShowing.get()) return;
+  // The children are positioned relative to the modal
+  auto l_motionEvent{ motionEvent };
+  l_motionEvent.x -= position.x;
+  l_motionEvent.y -= position.y;
+  for (const auto view : views) view->reactMouseMotion(l_motionEvent);
+  markDirtyIfChanged();
+}
+
+void FadeModal::reactMouseButtonDown(const SDL_MouseButtonEvent& buttonEvent) {
+  if (!isShowing.get()) return;
+  auto l_buttonEvent{ buttonEvent };
+  l_buttonEvent.x -= position.x;
+  l_buttonEvent.y -= position.y;
+  for (const auto view : views) view->reactMouseButtonDown(l_buttonEvent);
+  markDirtyIfChanged();
+}
+
+void FadeModal::reactMouseButtonUp(const SDL_MouseButtonEvent& buttonEvent) {
+  if (!isShowing.get()) return;
+  auto l_buttonEvent{ buttonEvent };
+  l_buttonEvent.x -= position.x;
+  l_buttonEvent.y -= position.y;
+  for (const auto view : views) view->reactMouseButtonUp(l_buttonEvent);
+  markDirtyIfChanged();
+}
+
+void FadeModal::step(const unsigned int dt) {
+  if (isShowing.get()) {
+    // The children may have been left hovered when the modal was hidden, so they are captured again when it is shown
+    if (a == 0u) isStale = true;
+    a = min(a + dt, fadeDuration);
+  } else {
+    a = dt < a ? a - dt : 0u;
+  }
+  dirtyDuration = dt < dirtyDuration ? dirtyDuration - dt : 0u;
+  if (a == 0u) return;
+  for (const auto view : views) view->step(dt);
+}
+
+void FadeModal::checkAndReactHits(const unsigned int dt) {
+  if (a == 0u) return;
+  for (const auto view : views) view->checkAndReactHits(dt);
+}
+
+void FadeModal::renderViews() {
+  const SDL_Rect backgroundRect{ 0, 0, background.size.w, background.size.h };
+  SDL_SetRenderDrawColor(getRenderer(), static_cast<Uint8>(background.color.r), static_cast<Uint8>(background.color.g),
+    static_cast<Uint8>(background.color.b), 255u);
+  SDL_RenderFillRect(getRenderer(), &backgroundRect);
+  for (const auto view : views) view->render();
+}
+
+void FadeModal::renderComposite() {
+  const auto prevTarget{ SDL_GetRenderTarget(getRenderer()) };
+  SDL_SetRenderTarget(getRenderer(), composite);
+  renderViews();
+  SDL_SetRenderTarget(getRenderer(), prevTarget);
+}
+
+void FadeModal::checkRenderResets() {
+  if (renderDeviceResetCount != getRenderDeviceResetCount()) {
+    renderDeviceResetCount = getRenderDeviceResetCount();
+    // It is recreated and rendered again before it is drawn
+    if (composite) {
+      trackFree(MemoryCategory::MODAL_TREES, getTextureUsage(composite));
+      SDL_DestroyTexture(composite);
+      composite = nullptr;
+    }
+  }
+  if (renderTargetResetCount != getRenderTargetResetCount()) {
+    renderTargetResetCount = getRenderTargetResetCount();
+    isStale = true;
+  }
+}
+
+void FadeModal::render() {
+  if (a == 0u) return;
+  checkRenderResets();
+  if (isCompositeSupported && !composite) {
+    composite = SDL_CreateTexture(getRenderer(), SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, background.size.w,
+      background.size.h);
+    isCompositeSupported = composite;
+    if (composite) {
+      SDL_SetTextureBlendMode(composite, SDL_BLENDMODE_BLEND);
+      trackAllocation(MemoryCategory::MODAL_TREES, getTextureUsage(composite));
+      isStale = true;
+    }
+  }
+  if (!isCompositeSupported) {
+    // The children are drawn relative to the modal by moving the origin of the renderer
+    SDL_Rect prevViewport;
+    SDL_RenderGetViewport(getRenderer(), &prevViewport);
+    const SDL_Rect viewport{ prevViewport.x + position.x, prevViewport.y + position.y, background.size.w, background.size.h };
+    SDL_RenderSetViewport(getRenderer(), &viewport);
+    renderViews();
+    SDL_RenderSetViewport(getRenderer(), &prevViewport);
+    return;
+  }
+  if (isStale) {
+    renderComposite();
+    isStale = dirtyDuration != 0u;
+  }
+  SDL_SetTextureAlphaMod(composite, getA());
+  const SDL_Rect destinationRect{ position.x, position.y, background.size.w, background.size.h };
+  SDL_RenderCopy(getRenderer(), composite, nullptr, &destinationRect);
+  if (profiler) profiler->countDrawCalls(1u);
+}
+
+FadeModal::~FadeModal() {
+  for (const auto view : views) delete view;
+  if (composite) {
+    trackFree(MemoryCategory::MODAL_TREES, getTextureUsage(composite));
+    SDL_DestroyTexture(composite);
+  }
+}
+
+}  // namespace ii887522::snake
+
+#endif
@@ -0,0 +1,107 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_VIEW_FADEMODAL_H_
+#define SNAKE_SRC_MAIN_VIEW_FADEMODAL_H_
+
+#ifndef TEST
+
+#include <Any/View.h>
+#include <Any/Reactive.h>
+#include <Struct/Point.h>
+#include <Struct/Paint.h>
+#include <SDL.h>
+#include <initializer_list>
+#include <vector>
+#include "../Any/FrameProfiler.h"
+#include "HitGroup.h"
+
+using std::initializer_list;
+using std::vector;
+using ii887522::viewify::View;
+using ii887522::viewify::Action;
+using ii887522::viewify::Point;
+using ii887522::viewify::Paint;
+using ii887522::nitro::Reactive;
+
+namespace ii887522::snake {
+
+// It is a modal which renders its background and children once into a texture and fades that single texture in and out, rather
+// than fading each child on its own. So a frame in the middle of a fade costs 1 copy instead of a blended draw per child, which
+// matters most on software renderers. The children are only rendered into the texture again for a while after an input has
+// changed which buttons are hovered or pressed, which covers their lightness animations, or after the render targets have been
+// reset. The children are drawn at positions relative to the
+// top left corner of the modal, and they must be fully opaque as the modal fades them itself.
+// If the renderer cannot render into a texture, the children are drawn directly every frame without fading.
+// Not Thread Safe: it must only be used in main thread
+class FadeModal final : public View {
+  // remove copy semantics
+  FadeModal(const FadeModal&) = delete;
+  FadeModal& operator=(const FadeModal&) = delete;
+
+  // remove move semantics
+  FadeModal(FadeModal&&) = delete;
+  FadeModal& operator=(FadeModal&&) = delete;
+
+  const Point<int> position;
+  const Paint<int, unsigned int> background;
+  Reactive<bool>& isShowing;
+  const unsigned int fadeDuration;
+  const unsigned int inputDirtyDuration;
+  FrameProfiler*const profiler;
+  const HitGroup& buttons;
+  const vector<View*> views;
+  SDL_Texture* composite;
+  bool isCompositeSupported;
+  unsigned int a;  // in milliseconds of the fade shown, from 0 to fadeDuration
+  unsigned int dirtyDuration;  // in milliseconds, the children are rendered into the texture again until it reaches 0
+  bool isStale;  // whether the texture must be rendered again in the next frame
+  unsigned int renderTargetResetCount;  // the count last seen, see also ../Functions/event_ext.h for more details
+  unsigned int renderDeviceResetCount;  // the count last seen, see also ../Functions/event_ext.h for more details
+
+  constexpr Uint8 getA() const {
+    return static_cast<Uint8>(a * 255u / fadeDuration);
+  }
+
+  // Marks the texture as stale for a while if the last input has changed the buttons, so that their animations are captured.
+  constexpr void markDirtyIfChanged() {
+    if (!buttons.hasChanged()) return;
+    dirtyDuration = inputDirtyDuration;
+    isStale = true;
+  }
+
+  // Renders the texture again if the render targets have been reset, and recreates it if the render device has been reset.
+  void checkRenderResets();
+
+  void renderViews();
+  void renderComposite();
+
+ public:
+  // Param renderer: it must not be assigned to integer
+  // Param position: the top left corner of the modal in the window
+  // Param background: the size and the color of the modal
+  // Param isShowing: it must not be assigned to integer. The modal fades in while it is true and fades out while it is false.
+  // Param fadeDuration: in milliseconds, it must not be 0
+  // Param inputDirtyDuration: in milliseconds, how long the children are rendered into the texture again after an input. It must
+  //   cover the longest animation of the children.
+  // Param profiler: if it is not nullptr, the draw calls made by this view are counted into it
+  // Param buttons: the children which react to the mouse, it must be one of views
+  // Param views: each of them will be owned by this view
+  explicit FadeModal(SDL_Renderer*const renderer, const Point<int>& position, const Paint<int, unsigned int>& background,
+    Reactive<bool>*const isShowing, const unsigned int fadeDuration, const unsigned int inputDirtyDuration,
+    FrameProfiler*const profiler, const HitGroup*const buttons, const initializer_list<View*>& views);
+
+  Action reactKeyDown(const SDL_KeyboardEvent&) override;
+  Action reactKeyUp(const SDL_KeyboardEvent&) override;
+  void reactMouseMotion(const SDL_MouseMotionEvent&) override;
+  void reactMouseButtonDown(const SDL_MouseButtonEvent&) override;
+  void reactMouseButtonUp(const SDL_MouseButtonEvent&) override;
+  void step(const unsigned int dt) override;
+  void checkAndReactHits(const unsigned int dt) override;
+  void render() override;
+  ~FadeModal();
+};
+
+}  // namespace ii887522::snake
+
+#endif
+#endif  // SNAKE_SRC_MAIN_VIEW_FADEMODAL_H_
@@ -6,36 +6,104 @@
 #include <Any/View.h>
 #include <Struct/Rect.h>
 #include <Struct/Point.h>
-#include <Any/Map.h>
+#include <Struct/Color.h>
 #include <Any/Reactive.h>
 #include <SDL.h>
 #include <random>
+#include <functional>
+#include <chrono>  // NOLINT(build/c++11)
 #include "Any/Enums.h"
+#include "../Any/CellGrid.h"
+#include "../Any/Level.h"
+#include "../Any/Canvas.h"
+#include "../Any/FrameProfiler.h"
+#include "../Any/MemoryScope.h"
+#include "../Functions/trace.h"
+#include "../Functions/accounting.h"
+#include "BoardView.h"
 
 using std::default_random_engine;
 using std::uniform_int_distribution;
+using std::function;
+using std::chrono::high_resolution_clock;
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
 using ii887522::viewify::View;
 using ii887522::viewify::Rect;
 using ii887522::viewify::Point;
-using ii887522::viewify::Map;
+using ii887522::viewify::Color;
 using ii887522::nitro::Reactive;
 
 namespace ii887522::snake {
 
 Food::Food(SDL_Renderer*const renderer, const Rect<int>& wallRect, const int cellSize, default_random_engine& randomEngine,
-  Map<CellType>& map, Reactive<bool>*const isEaten) : View{ renderer }, xs{ 1u, wallRect.size.w / cellSize - 2u },
-  ys{ 1u, wallRect.size.h / cellSize - 2u }, randomEngine{ randomEngine }, position{ Point{ 0u, 0u } }, map{ map }, cellSize{ cellSize } {
-  isEaten->watch([this](const bool& value, const int) {
+  CellGrid& map, Reactive<bool>*const isEaten, const function<void(const Point<unsigned int>&, unsigned long long)>& onSpawn,
+  FrameProfiler*const profiler, BoardView*const board) : View{ renderer }, xs{ 1u, map.getSize().w - 2u },
+  ys{ 1u, map.getSize().h - 2u }, foodZoneCellCount{ 0ull }, randomEngine{ randomEngine }, position{ Point{ 0u, 0u } }, map{ map }, cellSize{ cellSize },
+  onSpawn{ onSpawn }, profiler{ profiler }, board{ board }, watcherUsage{ 0ll, 0ll } {
+  watchTracked(isEaten, [this](const bool& value, const int) {
     if (!value) return;
     spawn();
-  });
-  position.watch([this, wallRect, cellSize](const Point<unsigned int>& value, const int) {
+  }, &watcherUsage);
+  watchTracked(&position, [this, wallRect, cellSize](const Point<unsigned int>& value, const int) {
     getPosition().set(wallRect.position + static_cast<Point<int>>(value * cellSize));
-  });
+  }, &watcherUsage);
+  if (map.getLevel()) {
+    for (auto i{ 0u }; i != map.getLevel()->getFoodZoneCount(); ++i) {
+      const auto& foodZone{ map.getLevel()->getFoodZone(i) };
+      foodZoneCellCount += static_cast<unsigned long long>(foodZone.size.w) * foodZone.size.h;
+    }
+  }
+  if (board) {
+    board->addLayer([this](Canvas& canvas, const Point<int>& origin, const SDL_Rect& clip) {
+      const auto rect{ getRect(origin) };
+      if (!SDL_HasIntersection(&rect, &clip)) return;
+      canvas.fillRect(rect, Color{ 255u, 255u, 0u });
+      if (this->profiler) this->profiler->countDrawCalls(1u);
+    });
+  }
   spawn();
 }
 
+SDL_Rect Food::getRect(const Point<int>& origin) const {
+  return SDL_Rect{
+    origin.x + static_cast<int>(position.get().x) * cellSize, origin.y + static_cast<int>(position.get().y) * cellSize, cellSize,
+    cellSize
+  };
+}
+
+bool Food::findSpawnablePositionInFoodZones(Point<unsigned int>*const result) {
+  if (foodZoneCellCount == 0ull) return false;
+  const auto& level{ *map.getLevel() };
+  // Every cell of the food zones is equally likely to be picked first, then the cells after it are tried in turn
+  auto cellIndex{ uniform_int_distribution<unsigned long long>{ 0ull, foodZoneCellCount - 1ull }(randomEngine) };
+  auto zoneIndex{ 0u };
+  for (; cellIndex >= static_cast<unsigned long long>(level.getFoodZone(zoneIndex).size.w) * level.getFoodZone(zoneIndex).size.h;
+    ++zoneIndex) {
+    cellIndex -= static_cast<unsigned long long>(level.getFoodZone(zoneIndex).size.w) * level.getFoodZone(zoneIndex).size.h;
+  }
+  for (auto i{ 0u }; i <= level.getFoodZoneCount(); ++i) {
+    const auto& foodZone{ level.getFoodZone((zoneIndex + i) % level.getFoodZoneCount()) };
+    const auto zoneCellCount{ static_cast<unsigned long long>(foodZone.size.w) * foodZone.size.h };
+    // The zone picked first is tried from the cell picked to its end first, and from its beginning to that cell last
+    const auto begin{ i == 0u ? cellIndex : 0ull };
+    const auto end{ i == level.getFoodZoneCount() ? cellIndex : zoneCellCount };
+    for (auto j{ begin }; j < end; ++j) {
+      const Point position{
+        foodZone.position.x + static_cast<unsigned int>(j % foodZone.size.w),
+        foodZone.position.y + static_cast<unsigned int>(j / foodZone.size.w)
+      };
+      if (map.get(position) != CellType::BACKGROUND) continue;
+      *result = position;
+      return true;
+    }
+  }
+  return false;
+}
+
 Point<unsigned int> Food::getRandomSpawnablePosition() {
+  Point zonePosition{ 0u, 0u };
+  if (findSpawnablePositionInFoodZones(&zonePosition)) return zonePosition;
   Point l_position{ xs(randomEngine), ys(randomEngine) };
   while (true) {
     if (map.get(l_position) != CellType::BACKGROUND) {
@@ -53,14 +121,26 @@ Point<unsigned int> Food::getRandomSpawnablePosition() {
 }
 
 void Food::spawn() {
+  const auto begin{ high_resolution_clock::now() };
+  if (board) board->damage(getRect(Point{ 0, 0 }));
   position.set(getRandomSpawnablePosition());
   map.set(position.get(), CellType::FOOD);
+  if (board) board->damage(getRect(Point{ 0, 0 }));
+  const auto end{ high_resolution_clock::now() };
+  traceComplete("Food::spawn", "simulation", begin, end);
+  onSpawn(position.get(), duration_cast<microseconds>(end - begin).count());
 }
 
 void Food::render() {
+  if (board) return;
   SDL_SetRenderDrawColor(getRenderer(), 255u, 255u, 0u, 255u);
   const SDL_Rect rect{ getPosition().get().x, getPosition().get().y, cellSize, cellSize };
   SDL_RenderFillRect(getRenderer(), &rect);
+  if (profiler) profiler->countDrawCalls(1u);
+}
+
+Food::~Food() {
+  trackFree(MemoryCategory::REACTIVE_WATCHERS, watcherUsage);
 }
 
 }  // namespace ii887522::snake
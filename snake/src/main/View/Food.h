@@ -7,23 +7,30 @@
 
 #include <Any/View.h>
 #include <Struct/Rect.h>
-#include <Any/Map.h>
 #include <Any/Reactive.h>
 #include <Struct/Point.h>
 #include <SDL.h>
 #include <random>
+#include <functional>
 #include "../Any/Enums.h"
+#include "../Any/CellGrid.h"
+#include "../Any/Level.h"
+#include "../Any/FrameProfiler.h"
+#include "../Struct/MemoryUsage.h"
+#include "BoardView.h"
 
 using std::uniform_int_distribution;
 using std::default_random_engine;
+using std::function;
 using ii887522::viewify::View;
 using ii887522::viewify::Rect;
-using ii887522::viewify::Map;
 using ii887522::nitro::Reactive;
 using ii887522::viewify::Point;
 
 namespace ii887522::snake {
 
+// If the map has a level with food zones, the food only spawns in them as long as they have room left, see also ../Any/Level.h for
+// more details
 // Not Thread Safe: it must only be used in main thread
 class Food final : public View {
   // remove copy semantics
@@ -36,20 +43,39 @@ class Food final : public View {
 
   uniform_int_distribution<unsigned int> xs;
   uniform_int_distribution<unsigned int> ys;
+  unsigned long long foodZoneCellCount;  // the number of cells in the food zones of the level of the map, or 0 if there are none
   default_random_engine& randomEngine;
   Reactive<Point<unsigned int>> position;
-  Map<CellType>& map;
+  CellGrid& map;
   const int cellSize;
+  const function<void(const Point<unsigned int>&, unsigned long long)> onSpawn;
+  FrameProfiler*const profiler;
+  BoardView*const board;
+  MemoryUsage watcherUsage;
+
+  // Return: the food rect relative to origin
+  SDL_Rect getRect(const Point<int>& origin) const;
+
+  // Param result: a random background cell in the food zones is stored into it if any
+  // Return: whether there is a background cell in the food zones
+  bool findSpawnablePositionInFoodZones(Point<unsigned int>*const result);
 
   Point<unsigned int> getRandomSpawnablePosition();
   void spawn();
 
  public:
   // Param renderer: it must not be assigned to integer
-  explicit Food(SDL_Renderer*const renderer, const Rect<int>& wallRect, const int cellSize, default_random_engine&, Map<CellType>&,
-    Reactive<bool>*const isEaten);
+  // Param onSpawn: it is called with the cell position and how long it took in microseconds whenever the food is spawned
+  // Param profiler: draw calls made by the food are counted into it if it is not nullptr
+  // Param board: if it is not nullptr, the food draws itself as a layer of the board and only reports the cells it changes to the
+  //   board instead of drawing onto the screen every frame
+  explicit Food(SDL_Renderer*const renderer, const Rect<int>& wallRect, const int cellSize, default_random_engine&, CellGrid&,
+    Reactive<bool>*const isEaten,
+    const function<void(const Point<unsigned int>&, unsigned long long)>& onSpawn = [](const Point<unsigned int>&, const unsigned long long) { },
+    FrameProfiler*const profiler = nullptr, BoardView*const board = nullptr);
 
   void render() override;
+  ~Food();
 };
 
 }  // namespace ii887522::snake
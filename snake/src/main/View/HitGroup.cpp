@@ -0,0 +1,112 @@
+// Copyright ii887522
+
+#ifndef TEST
+
+#include "HitGroup.h"
+#include <Any/View.h>
+#include <SDL.h>
+#include <initializer_list>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include "../Any/HitIndex.h"
+#include "../Struct/HitTarget.h"
+
+using std::initializer_list;
+using std::vector;
+using std::set_union;
+using std::back_inserter;
+using ii887522::viewify::View;
+using ii887522::viewify::Action;
+
+namespace ii887522::snake {
+
+static vector<View*> getViews(const initializer_list<HitTarget>& targets) {
+  vector<View*> result;
+  result.reserve(targets.size());
+  for (const auto& target : targets) result.push_back(target.view);
+  return result;
+}
+
+static vector<SDL_Rect> getRects(const initializer_list<HitTarget>& targets) {
+  vector<SDL_Rect> result;
+  result.reserve(targets.size());
+  for (const auto& target : targets) result.push_back(target.rect);
+  return result;
+}
+
+HitGroup::HitGroup(SDL_Renderer*const renderer, const initializer_list<HitTarget>& targets) : View{ renderer },
+  views{ getViews(targets) }, index{ getRects(targets) }, isChanged{ false } {
+  hits.reserve(views.size());
+  nextHits.reserve(views.size());
+  pressedViews.reserve(views.size());
+  receivers.reserve(views.size());
+}
+
+void HitGroup::findTargets(const SDL_Point& point) {
+  index.find(point, &nextHits);
+  receivers.clear();
+  set_union(hits.begin(), hits.end(), nextHits.begin(), nextHits.end(), back_inserter(receivers));
+  isChanged = hits != nextHits;
+  hits.swap(nextHits);
+}
+
+void HitGroup::merge(vector<unsigned int>*const indices, const vector<unsigned int>& others) {
+  nextHits.clear();
+  set_union(indices->begin(), indices->end(), others.begin(), others.end(), back_inserter(nextHits));
+  indices->swap(nextHits);
+}
+
+Action HitGroup::reactKeyDown(const SDL_KeyboardEvent& keyEvent) {
+  for (const auto view : views) {
+    if (view->reactKeyDown(keyEvent) == Action::QUIT) return Action::QUIT;
+  }
+  return Action::NONE;
+}
+
+Action HitGroup::reactKeyUp(const SDL_KeyboardEvent& keyEvent) {
+  for (const auto view : views) {
+    if (view->reactKeyUp(keyEvent) == Action::QUIT) return Action::QUIT;
+  }
+  return Action::NONE;
+}
+
+void HitGroup::reactMouseMotion(const SDL_MouseMotionEvent& motionEvent) {
+  findTargets(SDL_Point{ motionEvent.x, motionEvent.y });
+  for (const auto i : receivers) views[i]->reactMouseMotion(motionEvent);
+}
+
+void HitGroup::reactMouseButtonDown(const SDL_MouseButtonEvent& buttonEvent) {
+  findTargets(SDL_Point{ buttonEvent.x, buttonEvent.y });
+  isChanged = !receivers.empty();
+  for (const auto i : receivers) views[i]->reactMouseButtonDown(buttonEvent);
+  merge(&pressedViews, receivers);
+}
+
+void HitGroup::reactMouseButtonUp(const SDL_MouseButtonEvent& buttonEvent) {
+  findTargets(SDL_Point{ buttonEvent.x, buttonEvent.y });
+  merge(&receivers, pressedViews);
+  pressedViews.clear();
+  isChanged = !receivers.empty();
+  for (const auto i : receivers) views[i]->reactMouseButtonUp(buttonEvent);
+}
+
+void HitGroup::step(const unsigned int dt) {
+  for (const auto view : views) view->step(dt);
+}
+
+void HitGroup::checkAndReactHits(const unsigned int dt) {
+  for (const auto view : views) view->checkAndReactHits(dt);
+}
+
+void HitGroup::render() {
+  for (const auto view : views) view->render();
+}
+
+HitGroup::~HitGroup() {
+  for (const auto view : views) delete view;
+}
+
+}  // namespace ii887522::snake
+
+#endif
@@ -0,0 +1,79 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_VIEW_HITGROUP_H_
+#define SNAKE_SRC_MAIN_VIEW_HITGROUP_H_
+
+#ifndef TEST
+
+#include <Any/View.h>
+#include <SDL.h>
+#include <initializer_list>
+#include <vector>
+#include "../Any/HitIndex.h"
+#include "../Struct/HitTarget.h"
+
+using std::initializer_list;
+using std::vector;
+using ii887522::viewify::View;
+using ii887522::viewify::Action;
+
+namespace ii887522::snake {
+
+// It is a group of interactive views, such as buttons, which only passes a mouse event to the views whose regions contain the
+// mouse, found through a spatial index rather than by asking every view in turn. The views which contained the mouse in the
+// previous event get the event as well, so that they can tell the mouse has left them, and the views which got a button down get
+// the next button up wherever it happens, so that they are never left pressed. Every other call is passed to all views.
+// See also ../Any/HitIndex.h for more details
+// Not Thread Safe: it must only be used in main thread
+class HitGroup final : public View {
+  // remove copy semantics
+  HitGroup(const HitGroup&) = delete;
+  HitGroup& operator=(const HitGroup&) = delete;
+
+  // remove move semantics
+  HitGroup(HitGroup&&) = delete;
+  HitGroup& operator=(HitGroup&&) = delete;
+
+  const vector<View*> views;
+  const HitIndex index;
+  vector<unsigned int> hits;  // the indices of the views containing the mouse in the previous event
+  vector<unsigned int> nextHits;
+  vector<unsigned int> pressedViews;  // the indices of the views which got a button down since the last button up
+  vector<unsigned int> receivers;  // the indices of the views the current event is passed to
+  bool isChanged;  // whether the last mouse event may have changed how the views look
+
+  // Finds the views the mouse event at the point given must be passed to and stores them into receivers.
+  void findTargets(const SDL_Point&);
+
+  // Adds the indices of others which are not in indices yet into it. It uses nextHits as scratch, so it must be called after
+  // findTargets().
+  // Param indices: it must be sorted and must not be nextHits
+  // Param others: it must be sorted and must not be nextHits
+  void merge(vector<unsigned int>*const indices, const vector<unsigned int>& others);
+
+ public:
+  // Param renderer: it must not be assigned to integer
+  // Param targets: each view will be owned by this view, and it is rendered in the order given
+  explicit HitGroup(SDL_Renderer*const renderer, const initializer_list<HitTarget>& targets);
+
+  // Return: whether the last mouse event may have changed how the views look, which is when it has changed the views containing
+  //   the mouse or a button has been pressed or released on any of them
+  constexpr bool hasChanged() const {
+    return isChanged;
+  }
+
+  Action reactKeyDown(const SDL_KeyboardEvent&) override;
+  Action reactKeyUp(const SDL_KeyboardEvent&) override;
+  void reactMouseMotion(const SDL_MouseMotionEvent&) override;
+  void reactMouseButtonDown(const SDL_MouseButtonEvent&) override;
+  void reactMouseButtonUp(const SDL_MouseButtonEvent&) override;
+  void step(const unsigned int dt) override;
+  void checkAndReactHits(const unsigned int dt) override;
+  void render() override;
+  ~HitGroup();
+};
+
+}  // namespace ii887522::snake
+
+#endif
+#endif  // SNAKE_SRC_MAIN_VIEW_HITGROUP_H_
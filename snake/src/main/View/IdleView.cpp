@@ -0,0 +1,72 @@
+// Copyright ii887522
+
+#ifndef TEST
+
+#include "IdleView.h"
+#include <Any/View.h>
+#include <SDL.h>
+#include <initializer_list>
+#include "../Any/IdleMonitor.h"
+
+using std::initializer_list;
+using ii887522::viewify::View;
+using ii887522::viewify::Action;
+
+namespace ii887522::snake {
+
+IdleView::IdleView(SDL_Renderer*const renderer, IdleMonitor*const monitor, const unsigned int inputAwakeDuration,
+  const initializer_list<View*>& views) : View{ renderer }, monitor{ *monitor }, inputAwakeDuration{ inputAwakeDuration },
+  views{ views }, frameDt{ 0u } { }
+
+Action IdleView::reactKeyDown(const SDL_KeyboardEvent& keyEvent) {
+  monitor.keepAwakeFor(inputAwakeDuration);
+  for (const auto view : views) {
+    if (view->reactKeyDown(keyEvent) == Action::QUIT) return Action::QUIT;
+  }
+  return Action::NONE;
+}
+
+Action IdleView::reactKeyUp(const SDL_KeyboardEvent& keyEvent) {
+  monitor.keepAwakeFor(inputAwakeDuration);
+  for (const auto view : views) {
+    if (view->reactKeyUp(keyEvent) == Action::QUIT) return Action::QUIT;
+  }
+  return Action::NONE;
+}
+
+void IdleView::reactMouseMotion(const SDL_MouseMotionEvent& motionEvent) {
+  monitor.keepAwakeFor(inputAwakeDuration);
+  for (const auto view : views) view->reactMouseMotion(motionEvent);
+}
+
+void IdleView::reactMouseButtonDown(const SDL_MouseButtonEvent& buttonEvent) {
+  monitor.keepAwakeFor(inputAwakeDuration);
+  for (const auto view : views) view->reactMouseButtonDown(buttonEvent);
+}
+
+void IdleView::reactMouseButtonUp(const SDL_MouseButtonEvent& buttonEvent) {
+  monitor.keepAwakeFor(inputAwakeDuration);
+  for (const auto view : views) view->reactMouseButtonUp(buttonEvent);
+}
+
+void IdleView::step(const unsigned int dt) {
+  frameDt = monitor.clampDt(dt);
+  for (const auto view : views) view->step(frameDt);
+  monitor.waitIfIdle();
+}
+
+void IdleView::checkAndReactHits(const unsigned int) {
+  for (const auto view : views) view->checkAndReactHits(frameDt);
+}
+
+void IdleView::render() {
+  for (const auto view : views) view->render();
+}
+
+IdleView::~IdleView() {
+  for (const auto view : views) delete view;
+}
+
+}  // namespace ii887522::snake
+
+#endif
@@ -0,0 +1,62 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_VIEW_IDLEVIEW_H_
+#define SNAKE_SRC_MAIN_VIEW_IDLEVIEW_H_
+
+#ifndef TEST
+
+#include <Any/View.h>
+#include <SDL.h>
+#include <initializer_list>
+#include <vector>
+#include "../Any/IdleMonitor.h"
+
+using std::initializer_list;
+using std::vector;
+using ii887522::viewify::View;
+using ii887522::viewify::Action;
+
+namespace ii887522::snake {
+
+// It wraps the views which animate, keeps the idle monitor given awake on input and lets it block after stepping them. Blocking
+// while stepping rather than rendering ensures the last frame rendered has already been presented when the app idles. The frame
+// after a wait is stepped with the time since the wait ended, so that animations started by the input which ended it run from
+// their beginnings.
+// Not Thread Safe: it must only be used in main thread
+// See also ../Any/IdleMonitor.h for more details
+class IdleView final : public View {
+  // remove copy semantics
+  IdleView(const IdleView&) = delete;
+  IdleView& operator=(const IdleView&) = delete;
+
+  // remove move semantics
+  IdleView(IdleView&&) = delete;
+  IdleView& operator=(IdleView&&) = delete;
+
+  IdleMonitor& monitor;
+  const unsigned int inputAwakeDuration;
+  const vector<View*> views;
+  unsigned int frameDt;  // the duration of the current frame the views are stepped with
+
+ public:
+  // Param renderer: it must not be assigned to integer
+  // Param inputAwakeDuration: how long in milliseconds to stay awake after an input. It must cover the longest button animation.
+  // Param views: each view will be owned by this view, and it is rendered in the order given
+  explicit IdleView(SDL_Renderer*const renderer, IdleMonitor*const monitor, const unsigned int inputAwakeDuration,
+    const initializer_list<View*>& views);
+
+  Action reactKeyDown(const SDL_KeyboardEvent&) override;
+  Action reactKeyUp(const SDL_KeyboardEvent&) override;
+  void reactMouseMotion(const SDL_MouseMotionEvent&) override;
+  void reactMouseButtonDown(const SDL_MouseButtonEvent&) override;
+  void reactMouseButtonUp(const SDL_MouseButtonEvent&) override;
+  void step(const unsigned int dt) override;
+  void checkAndReactHits(const unsigned int dt) override;
+  void render() override;
+  ~IdleView();
+};
+
+}  // namespace ii887522::snake
+
+#endif
+#endif  // SNAKE_SRC_MAIN_VIEW_IDLEVIEW_H_
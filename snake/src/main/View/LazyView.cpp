@@ -0,0 +1,84 @@
+// Copyright ii887522
+
+#ifndef TEST
+
+#include "LazyView.h"
+#include <Any/View.h>
+#include <SDL.h>
+#include <functional>
+#include <optional>
+#include <chrono>  // NOLINT(build/c++11)
+#include "../Any/Enums.h"
+#include "../Any/MemoryScope.h"
+#include "../Struct/MemoryUsage.h"
+#include "../Functions/trace.h"
+#include "../Functions/accounting.h"
+
+using std::function;
+using std::optional;
+using std::chrono::high_resolution_clock;
+using ii887522::viewify::View;
+using ii887522::viewify::Action;
+
+namespace ii887522::snake {
+
+LazyView::LazyView(SDL_Renderer*const renderer, const char*const name, const function<View*()>& build,
+  const function<bool()>& canBuild, const optional<MemoryCategory>& category) : View{ renderer }, name{ name }, build{ build },
+  canBuild{ canBuild }, category{ category }, view{ nullptr }, memoryUsage{ 0ll, 0ll }, hasRendered{ false } { }
+
+bool LazyView::tryBuild() {
+  if (view) return true;
+  if (!hasRendered || !canBuild()) return false;
+  const auto begin{ high_resolution_clock::now() };
+  if (category) {
+    const MemoryScope memoryScope{ *category };
+    view = build();
+    memoryUsage = memoryScope.end();
+  } else {
+    view = build();
+  }
+  traceComplete(name, "startup", begin, high_resolution_clock::now());
+  return true;
+}
+
+Action LazyView::reactKeyDown(const SDL_KeyboardEvent& keyEvent) {
+  return tryBuild() ? view->reactKeyDown(keyEvent) : Action::NONE;
+}
+
+Action LazyView::reactKeyUp(const SDL_KeyboardEvent& keyEvent) {
+  return tryBuild() ? view->reactKeyUp(keyEvent) : Action::NONE;
+}
+
+void LazyView::reactMouseMotion(const SDL_MouseMotionEvent& motionEvent) {
+  if (tryBuild()) view->reactMouseMotion(motionEvent);
+}
+
+void LazyView::reactMouseButtonDown(const SDL_MouseButtonEvent& buttonEvent) {
+  if (tryBuild()) view->reactMouseButtonDown(buttonEvent);
+}
+
+void LazyView::reactMouseButtonUp(const SDL_MouseButtonEvent& buttonEvent) {
+  if (tryBuild()) view->reactMouseButtonUp(buttonEvent);
+}
+
+void LazyView::step(const unsigned int dt) {
+  if (tryBuild()) view->step(dt);
+}
+
+void LazyView::checkAndReactHits(const unsigned int dt) {
+  if (tryBuild()) view->checkAndReactHits(dt);
+}
+
+void LazyView::render() {
+  if (view) view->render();
+  hasRendered = true;
+}
+
+LazyView::~LazyView() {
+  delete view;
+  if (category) trackFree(*category, memoryUsage);
+}
+
+}  // namespace ii887522::snake
+
+#endif
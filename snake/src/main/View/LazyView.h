@@ -0,0 +1,75 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_VIEW_LAZYVIEW_H_
+#define SNAKE_SRC_MAIN_VIEW_LAZYVIEW_H_
+
+#ifndef TEST
+
+#include <Any/View.h>
+#include <SDL.h>
+#include <functional>
+#include <optional>
+#include "../Any/Enums.h"
+#include "../Struct/MemoryUsage.h"
+
+using std::function;
+using std::optional;
+using std::nullopt;
+using ii887522::viewify::View;
+using ii887522::viewify::Action;
+
+namespace ii887522::snake {
+
+// It stands in for a view which is expensive to build, such as a page or a modal, and builds it on the first call it receives
+// after it has been rendered once and the assets it needs are ready. So the first frame shown never waits for it, while it is
+// still ready right after that, before the user can navigate to it. Once built, every call is forwarded to the view built.
+// Not Thread Safe: it must only be used in main thread
+class LazyView final : public View {
+  // remove copy semantics
+  LazyView(const LazyView&) = delete;
+  LazyView& operator=(const LazyView&) = delete;
+
+  // remove move semantics
+  LazyView(LazyView&&) = delete;
+  LazyView& operator=(LazyView&&) = delete;
+
+  const char*const name;
+  const function<View*()> build;
+  const function<bool()> canBuild;
+  const optional<MemoryCategory> category;
+  View* view;
+  MemoryUsage memoryUsage;  // the memory charged to the category when the view was built
+  bool hasRendered;
+
+  // Return: whether the view has been built
+  bool tryBuild();
+
+ public:
+  // Param renderer: it must not be assigned to integer
+  // Param name: it must point to a string literal. It names the build in the timeline trace.
+  // Param build: it must return a new view which will be owned by this view
+  // Param canBuild: it tells whether everything the view needs is ready to build it
+  // Param category: if it is set, the memory the view is built with is charged to it, see also ../Any/MemoryScope.h for more
+  //   details
+  explicit LazyView(SDL_Renderer*const renderer, const char*const name, const function<View*()>& build,
+    const function<bool()>& canBuild = []() { return true; }, const optional<MemoryCategory>& category = nullopt);
+
+  constexpr bool isBuilt() const {
+    return view;
+  }
+
+  Action reactKeyDown(const SDL_KeyboardEvent&) override;
+  Action reactKeyUp(const SDL_KeyboardEvent&) override;
+  void reactMouseMotion(const SDL_MouseMotionEvent&) override;
+  void reactMouseButtonDown(const SDL_MouseButtonEvent&) override;
+  void reactMouseButtonUp(const SDL_MouseButtonEvent&) override;
+  void step(const unsigned int dt) override;
+  void checkAndReactHits(const unsigned int dt) override;
+  void render() override;
+  ~LazyView();
+};
+
+}  // namespace ii887522::snake
+
+#endif
+#endif  // SNAKE_SRC_MAIN_VIEW_LAZYVIEW_H_
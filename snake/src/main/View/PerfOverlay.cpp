@@ -0,0 +1,101 @@
+// Copyright ii887522
+
+#ifndef TEST
+
+#include "PerfOverlay.h"
+#include <Any/View.h>
+#include <Struct/Rect.h>
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <Struct/Color.h>
+#include <SDL.h>
+#include <cstdio>
+#include <algorithm>
+#include <chrono>  // NOLINT(build/c++11)
+#include "../Any/GlyphAtlas.h"
+#include "../Struct/OverlayStats.h"
+
+using std::snprintf;
+using std::min;
+using std::chrono::high_resolution_clock;
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+using ii887522::viewify::View;
+using ii887522::viewify::Rect;
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+using ii887522::viewify::Color;
+using ii887522::viewify::Action;
+
+namespace ii887522::snake {
+
+PerfOverlay::PerfOverlay(SDL_Renderer*const renderer, const GlyphAtlas& atlas, const OverlayStats& stats, const Rect<int>& rect,
+  const unsigned int backgroundCellCount) : View{ renderer, rect.position }, atlas{ atlas }, stats{ stats }, rect{ rect },
+  graphRect{
+    Point{ rect.position.x + rect.size.w - 8 - static_cast<int>(FRAME_TIME_COUNT) * GRAPH_BAR_WIDTH, rect.position.y + 8 },
+    Size{ static_cast<int>(FRAME_TIME_COUNT) * GRAPH_BAR_WIDTH, rect.size.h - 16 }
+  }, backgroundCellCount{ backgroundCellCount }, isShowing{ false }, frameTimes{ }, frameTimeIndex{ 0u }, graphBars{ },
+  hasRendered{ false }, elapsed{ 0u }, frameCount{ 0u }, lastTickCount{ 0ull }, lines{ } { }
+
+Action PerfOverlay::reactKeyDown(const SDL_KeyboardEvent& keyEvent) {
+  if (keyEvent.keysym.sym == SDLK_F3) isShowing = !isShowing;
+  return Action::NONE;
+}
+
+void PerfOverlay::recordFrameTime() {
+  const auto now{ high_resolution_clock::now() };
+  if (hasRendered) {
+    const auto frameTime{ static_cast<unsigned int>(duration_cast<microseconds>(now - lastFrameTime).count()) };
+    frameTimes[frameTimeIndex] = frameTime;
+    frameTimeIndex = (frameTimeIndex + 1u) % FRAME_TIME_COUNT;
+    elapsed += frameTime;
+    ++frameCount;
+  }
+  lastFrameTime = now;
+  hasRendered = true;
+}
+
+void PerfOverlay::updateLines() {
+  const auto fps{ frameCount * 1000000ull / elapsed };
+  const auto ticksPerSecond{ (stats.tickCount - lastTickCount) * 1000000ull / elapsed };
+  const auto freeCellCount{ backgroundCellCount > stats.snakeLength ? backgroundCellCount - stats.snakeLength - 1u : 0u };
+  snprintf(lines[0u], LINE_CAPACITY, "FPS %llu  frame %.1f ms  ticks/s %llu", fps, elapsed / 1000. / frameCount, ticksPerSecond);
+  snprintf(lines[1u], LINE_CAPACITY, "length %u  free cells %u  spawn %llu us", stats.snakeLength, freeCellCount,
+    stats.lastSpawnDuration);
+  elapsed = 0u;
+  frameCount = 0u;
+  lastTickCount = stats.tickCount;
+}
+
+void PerfOverlay::renderGraph() {
+  for (auto i{ 0u }; i != FRAME_TIME_COUNT; ++i) {
+    const auto frameTime{ min(frameTimes[(frameTimeIndex + i) % FRAME_TIME_COUNT], GRAPH_MAX_FRAME_TIME) };
+    const auto barHeight{ static_cast<int>(static_cast<unsigned long long>(frameTime) * graphRect.size.h / GRAPH_MAX_FRAME_TIME) };
+    graphBars[i] = SDL_Rect{
+      graphRect.position.x + static_cast<int>(i) * GRAPH_BAR_WIDTH, graphRect.position.y + graphRect.size.h - barHeight, GRAPH_BAR_WIDTH,
+      barHeight
+    };
+  }
+  SDL_SetRenderDrawColor(getRenderer(), 0u, 192u, 0u, 255u);
+  SDL_RenderFillRects(getRenderer(), graphBars.data(), static_cast<int>(FRAME_TIME_COUNT));
+  const auto budgetY{ graphRect.position.y + graphRect.size.h - static_cast<int>(FRAME_BUDGET * graphRect.size.h / GRAPH_MAX_FRAME_TIME) };
+  SDL_SetRenderDrawColor(getRenderer(), 255u, 0u, 0u, 255u);
+  SDL_RenderDrawLine(getRenderer(), graphRect.position.x, budgetY, graphRect.position.x + graphRect.size.w - 1, budgetY);
+  SDL_SetRenderDrawColor(getRenderer(), 128u, 128u, 128u, 255u);
+  const SDL_Rect border{ graphRect.position.x, graphRect.position.y, graphRect.size.w, graphRect.size.h };
+  SDL_RenderDrawRect(getRenderer(), &border);
+}
+
+void PerfOverlay::render() {
+  recordFrameTime();
+  if (elapsed >= UPDATE_INTERVAL) updateLines();
+  if (!isShowing) return;
+  constexpr Color textColor{ 255u, 255u, 0u };
+  atlas.render(Point{ rect.position.x + 8, rect.position.y + 8 }, lines[0u], textColor);
+  atlas.render(Point{ rect.position.x + 8, rect.position.y + 8 + atlas.getLineHeight() }, lines[1u], textColor);
+  renderGraph();
+}
+
+}  // namespace ii887522::snake
+
+#endif
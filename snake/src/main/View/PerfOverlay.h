@@ -0,0 +1,85 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_VIEW_PERFOVERLAY_H_
+#define SNAKE_SRC_MAIN_VIEW_PERFOVERLAY_H_
+
+#ifndef TEST
+
+#include <Any/View.h>
+#include <Struct/Rect.h>
+#include <SDL.h>
+#include <array>
+#include <chrono>  // NOLINT(build/c++11)
+#include "../Any/GlyphAtlas.h"
+#include "../Struct/OverlayStats.h"
+
+using std::array;
+using std::chrono::high_resolution_clock;
+using ii887522::viewify::View;
+using ii887522::viewify::Rect;
+using ii887522::viewify::Action;
+
+namespace ii887522::snake {
+
+// It shows FPS, a rolling frame time graph, simulation ticks per second, snake length, free cell count and how long the last food
+// spawn took. The text is drawn from a pre-baked glyph atlas and only reformatted every UPDATE_INTERVAL, so showing the overlay
+// does not distort the numbers it shows. F3 shows or hides it.
+// Not Thread Safe: it must only be used in main thread
+// See also ../Any/GlyphAtlas.h for more details
+class PerfOverlay final : public View {
+  // remove copy semantics
+  PerfOverlay(const PerfOverlay&) = delete;
+  PerfOverlay& operator=(const PerfOverlay&) = delete;
+
+  // remove move semantics
+  PerfOverlay(PerfOverlay&&) = delete;
+  PerfOverlay& operator=(PerfOverlay&&) = delete;
+
+  static constexpr auto FRAME_TIME_COUNT{ 120u };  // the number of frames shown in the graph
+  static constexpr auto GRAPH_BAR_WIDTH{ 2 };
+  static constexpr auto GRAPH_MAX_FRAME_TIME{ 33333u };  // the frame time in microseconds drawn at the top of the graph
+  static constexpr auto FRAME_BUDGET{ 16667u };  // the frame time in microseconds needed to reach 60 FPS
+  static constexpr auto UPDATE_INTERVAL{ 500000u };  // the time in microseconds between text updates
+  static constexpr auto LINE_CAPACITY{ 64u };
+
+  const GlyphAtlas& atlas;
+  const OverlayStats& stats;
+  const Rect<int> rect;
+  const Rect<int> graphRect;
+  const unsigned int backgroundCellCount;
+  bool isShowing;
+  array<unsigned int, FRAME_TIME_COUNT> frameTimes;  // in microseconds, it is used as a ring buffer
+  unsigned int frameTimeIndex;  // the index of the oldest frame time
+  array<SDL_Rect, FRAME_TIME_COUNT> graphBars;
+  high_resolution_clock::time_point lastFrameTime;
+  bool hasRendered;
+  unsigned int elapsed;  // the time in microseconds since the text was last updated
+  unsigned int frameCount;  // the number of frames since the text was last updated
+  unsigned long long lastTickCount;  // stats.tickCount when the text was last updated
+  char lines[2u][LINE_CAPACITY];
+
+  void recordFrameTime();
+  void updateLines();
+  void renderGraph();
+
+ public:
+  // Param renderer: it must not be assigned to integer
+  // Param rect: the header band to draw the overlay in
+  // Param backgroundCellCount: the number of cells inside the walls
+  explicit PerfOverlay(SDL_Renderer*const renderer, const GlyphAtlas&, const OverlayStats&, const Rect<int>& rect,
+    const unsigned int backgroundCellCount);
+
+  // It must be called when the overlay is rendered again after frames it has not been rendered in, so that the time in between
+  // is not counted as a frame.
+  constexpr void resume() {
+    hasRendered = false;
+  }
+
+  Action reactKeyDown(const SDL_KeyboardEvent&) override;
+  void render() override;
+};
+
+}  // namespace ii887522::snake
+
+#endif
+#endif  // SNAKE_SRC_MAIN_VIEW_PERFOVERLAY_H_
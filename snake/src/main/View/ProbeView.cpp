@@ -0,0 +1,42 @@
+// Copyright ii887522
+
+#ifndef TEST
+
+#include "ProbeView.h"
+#include <Any/View.h>
+#include <SDL.h>
+#include "../Any/Enums.h"
+#include "../Any/FrameProfiler.h"
+
+using ii887522::viewify::View;
+using ii887522::viewify::Action;
+
+namespace ii887522::snake {
+
+ProbeView::ProbeView(SDL_Renderer*const renderer, FrameProfiler*const profiler, const unsigned int index) : View{ renderer },
+  profiler{ *profiler }, index{ index } { }
+
+Action ProbeView::reactKeyDown(const SDL_KeyboardEvent& keyEvent) {
+  profiler.mark(Phase::INPUT, index);
+  if (index != 0u) return Action::NONE;
+  if (keyEvent.keysym.sym == SDLK_F12) profiler.dump();
+  else if (keyEvent.keysym.sym == SDLK_F11) profiler.reset();
+  else if (keyEvent.keysym.sym == SDLK_F10) profiler.toggleTracing();
+  return Action::NONE;
+}
+
+void ProbeView::step(const unsigned int) {
+  profiler.mark(Phase::STEP, index);
+}
+
+void ProbeView::checkAndReactHits(const unsigned int) {
+  profiler.mark(Phase::CHECK_HITS, index);
+}
+
+void ProbeView::render() {
+  profiler.mark(Phase::RENDER, index);
+}
+
+}  // namespace ii887522::snake
+
+#endif
@@ -0,0 +1,48 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_VIEW_PROBEVIEW_H_
+#define SNAKE_SRC_MAIN_VIEW_PROBEVIEW_H_
+
+#ifndef TEST
+
+#include <Any/View.h>
+#include <SDL.h>
+#include "../Any/FrameProfiler.h"
+
+using ii887522::viewify::View;
+using ii887522::viewify::Action;
+
+namespace ii887522::snake {
+
+// It is an invisible view which tells the profiler given whenever it is reached in a phase of a frame. The first probe of a
+// profiler also dumps the stats collected when F12 is pressed, resets them when F11 is pressed and toggles timeline tracing when
+// F10 is pressed.
+// Not Thread Safe: it must only be used in main thread
+// See also ../Any/FrameProfiler.h for more details
+class ProbeView final : public View {
+  // remove copy semantics
+  ProbeView(const ProbeView&) = delete;
+  ProbeView& operator=(const ProbeView&) = delete;
+
+  // remove move semantics
+  ProbeView(ProbeView&&) = delete;
+  ProbeView& operator=(ProbeView&&) = delete;
+
+  FrameProfiler& profiler;
+  const unsigned int index;
+
+ public:
+  // Param renderer: it must not be assigned to integer
+  // Param index: it must be less than profiler.getProbeCount()
+  explicit ProbeView(SDL_Renderer*const renderer, FrameProfiler*const profiler, const unsigned int index);
+
+  Action reactKeyDown(const SDL_KeyboardEvent&) override;
+  void step(const unsigned int dt) override;
+  void checkAndReactHits(const unsigned int dt) override;
+  void render() override;
+};
+
+}  // namespace ii887522::snake
+
+#endif
+#endif  // SNAKE_SRC_MAIN_VIEW_PROBEVIEW_H_
@@ -0,0 +1,169 @@
+// Copyright ii887522
+
+#ifndef TEST
+
+#include "ReplayView.h"
+#include <Any/View.h>
+#include <Struct/Rect.h>
+#include <Struct/Point.h>
+#include <Struct/Size.h>
+#include <Any/Reactive.h>
+#include <SDL.h>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+#include "../Any/Enums.h"
+#include "../Any/ReplayReader.h"
+#include "../Model/Simulation.h"
+#include "../Any/MemoryScope.h"
+#include "../Functions/accounting.h"
+
+using std::string;
+using std::vector;
+using std::runtime_error;
+using std::clamp;
+using ii887522::viewify::Action;
+using ii887522::viewify::Point;
+using ii887522::viewify::Size;
+
+namespace ii887522::snake {
+
+ReplayView::ReplayView(SDL_Renderer*const renderer, const string& dirPath, const Rect<int>& wallRect, const int cellSize,
+  Reactive<Path>*const currentPath) : View{ renderer }, dirPath{ dirPath }, wallRect{ wallRect },
+  scrubBarRect{ Point{ wallRect.position.x + 16, 24 }, Size{ wallRect.size.w - 32, 16 } }, cellSize{ cellSize }, tickDuration{ 62u },
+  currentPath{ *currentPath }, reader{ nullptr }, simulation{ nullptr }, isPlaying{ false }, elapsed{ 0u },
+  watcherUsage{ 0ll, 0ll } {
+  watchTracked(currentPath, [this](const Path& value, const int) {
+    if (value == Path::REPLAY) load();
+  }, &watcherUsage);
+}
+
+void ReplayView::load() {
+  delete simulation;
+  simulation = nullptr;
+  delete reader;
+  reader = nullptr;
+  isPlaying = false;
+  elapsed = 0u;
+  const auto filePath{ ReplayReader::getLatestFilePath(dirPath) };
+  if (filePath == "") return;
+  try {
+    reader = new ReplayReader{ filePath };
+  } catch (const runtime_error&) {
+    return;
+  }
+  simulation = new Simulation{ reader->getBoardSize() };
+  reader->seek(0u, simulation);
+}
+
+void ReplayView::seek(const int tick) {
+  if (!reader) return;
+  reader->seek(static_cast<unsigned int>(clamp(tick, 0, static_cast<int>(reader->getTickCount()))), simulation);
+  elapsed = 0u;
+}
+
+Action ReplayView::reactKeyDown(const SDL_KeyboardEvent& keyEvent) {
+  if (keyEvent.keysym.sym == SDLK_ESCAPE) {
+    isPlaying = false;
+    currentPath.set(Path::MAIN);
+    return Action::QUIT;
+  }
+  if (!reader) return Action::QUIT;
+  const auto tick{ static_cast<int>(simulation->getTick()) };
+  const auto tickCount{ static_cast<int>(reader->getTickCount()) };
+  const auto keyframeInterval{ static_cast<int>(reader->getKeyframeInterval()) };
+  switch (keyEvent.keysym.sym) {
+    case SDLK_SPACE: isPlaying = !isPlaying;
+      break;
+    case SDLK_RIGHT: seek(tick + 1);
+      break;
+    case SDLK_LEFT: seek(tick - 1);
+      break;
+    case SDLK_UP: seek(tick + keyframeInterval);
+      break;
+    case SDLK_DOWN: seek(tick - keyframeInterval);
+      break;
+    case SDLK_PAGEUP: seek(tick + tickCount / 10);
+      break;
+    case SDLK_PAGEDOWN: seek(tick - tickCount / 10);
+      break;
+    case SDLK_HOME: seek(0);
+      break;
+    case SDLK_END: seek(tickCount);
+      break;
+    default:
+      if (keyEvent.keysym.sym >= SDLK_0 && keyEvent.keysym.sym <= SDLK_9)
+        seek(static_cast<int>(static_cast<long long>(tickCount) * (keyEvent.keysym.sym - SDLK_0) / 10));
+  }
+  return Action::QUIT;
+}
+
+void ReplayView::step(const unsigned int dt) {
+  if (!isPlaying) return;
+  elapsed += dt;
+  while (elapsed >= tickDuration && simulation->getTick() < reader->getTickCount() && !simulation->isOver()) {
+    reader->stepForward(simulation);
+    elapsed -= tickDuration;
+  }
+  if (simulation->getTick() >= reader->getTickCount() || simulation->isOver()) isPlaying = false;
+}
+
+void ReplayView::renderScrubBar() {
+  SDL_SetRenderDrawColor(getRenderer(), 64u, 64u, 64u, 255u);
+  const SDL_Rect barRect{ scrubBarRect.position.x, scrubBarRect.position.y, scrubBarRect.size.w, scrubBarRect.size.h };
+  SDL_RenderFillRect(getRenderer(), &barRect);
+  if (!reader || reader->getTickCount() == 0u) return;
+  SDL_SetRenderDrawColor(getRenderer(), 255u, 255u, 255u, 255u);
+  const SDL_Rect progressRect{
+    scrubBarRect.position.x, scrubBarRect.position.y,
+    static_cast<int>(static_cast<long long>(scrubBarRect.size.w) * simulation->getTick() / reader->getTickCount()), scrubBarRect.size.h
+  };
+  SDL_RenderFillRect(getRenderer(), &progressRect);
+}
+
+void ReplayView::renderBoard() {
+  const auto& size{ simulation->getSize() };
+  const auto boardW{ static_cast<int>(size.w) * cellSize };
+  const auto boardH{ static_cast<int>(size.h) * cellSize };
+  SDL_SetRenderDrawColor(getRenderer(), 255u, 0u, 0u, 255u);
+  const SDL_Rect wallRects[]{
+    SDL_Rect{ wallRect.position.x, wallRect.position.y, boardW, cellSize },
+    SDL_Rect{ wallRect.position.x, wallRect.position.y + boardH - cellSize, boardW, cellSize },
+    SDL_Rect{ wallRect.position.x, wallRect.position.y, cellSize, boardH },
+    SDL_Rect{ wallRect.position.x + boardW - cellSize, wallRect.position.y, cellSize, boardH }
+  };
+  SDL_RenderFillRects(getRenderer(), wallRects, sizeof wallRects / sizeof wallRects[0]);
+  vector<SDL_Rect> bodyRects;
+  bodyRects.reserve(simulation->getBody().size());
+  for (const auto& position : simulation->getBody()) {
+    bodyRects.push_back(SDL_Rect{
+      wallRect.position.x + static_cast<int>(position.x) * cellSize, wallRect.position.y + static_cast<int>(position.y) * cellSize,
+      cellSize, cellSize
+    });
+  }
+  SDL_SetRenderDrawColor(getRenderer(), 0u, 255u, 0u, 255u);
+  SDL_RenderFillRects(getRenderer(), bodyRects.data(), static_cast<int>(bodyRects.size()));
+  if (!simulation->isFoodSpawned()) return;
+  SDL_SetRenderDrawColor(getRenderer(), 255u, 255u, 0u, 255u);
+  const SDL_Rect foodRect{
+    wallRect.position.x + static_cast<int>(simulation->getFood().x) * cellSize,
+    wallRect.position.y + static_cast<int>(simulation->getFood().y) * cellSize, cellSize, cellSize
+  };
+  SDL_RenderFillRect(getRenderer(), &foodRect);
+}
+
+void ReplayView::render() {
+  renderScrubBar();
+  if (simulation) renderBoard();
+}
+
+ReplayView::~ReplayView() {
+  delete simulation;
+  delete reader;
+  trackFree(MemoryCategory::REACTIVE_WATCHERS, watcherUsage);
+}
+
+}  // namespace ii887522::snake
+
+#endif
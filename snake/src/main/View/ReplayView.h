@@ -0,0 +1,79 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_VIEW_REPLAYVIEW_H_
+#define SNAKE_SRC_MAIN_VIEW_REPLAYVIEW_H_
+
+#ifndef TEST
+
+#include <Any/View.h>
+#include <Struct/Rect.h>
+#include <Any/Reactive.h>
+#include <SDL.h>
+#include <string>
+#include "../Any/Enums.h"
+#include "../Any/ReplayReader.h"
+#include "../Model/Simulation.h"
+#include "../Struct/MemoryUsage.h"
+
+using std::string;
+using ii887522::viewify::View;
+using ii887522::viewify::Rect;
+using ii887522::viewify::Action;
+using ii887522::nitro::Reactive;
+
+namespace ii887522::snake {
+
+// It shows the latest replay recorded and lets the user scrub to any tick instantly.
+// Key bindings: Space plays or pauses, Left and Right step 1 tick, Down and Up jump 1 keyframe interval, Page Down and Page Up
+// jump 10%, Home and End jump to both ends, 0 to 9 jump to 0% to 90% and Escape goes back to the main page.
+// Not Thread Safe: it must only be used in main thread
+// See also ../Any/View.h for more details
+class ReplayView final : public View {
+  // remove copy semantics
+  ReplayView(const ReplayView&) = delete;
+  ReplayView& operator=(const ReplayView&) = delete;
+
+  // remove move semantics
+  ReplayView(ReplayView&&) = delete;
+  ReplayView& operator=(ReplayView&&) = delete;
+
+  const string dirPath;
+  const Rect<int> wallRect;
+  const Rect<int> scrubBarRect;
+  const int cellSize;
+  const unsigned int tickDuration;
+  Reactive<Path>& currentPath;
+  ReplayReader* reader;
+  Simulation* simulation;  // it is created after a replay is loaded because the board size is stored in the replay
+  bool isPlaying;
+  unsigned int elapsed;  // the time elapsed since the last tick while playing
+  MemoryUsage watcherUsage;
+
+  void load();
+
+  // Param tick: it will be clamped to the range of ticks in the replay
+  void seek(const int tick);
+
+  void renderScrubBar();
+  void renderBoard();
+
+ public:
+  // Param renderer: it must not be assigned to integer
+  // Param dirPath: it must end with a slash, or be empty to show no replay
+  explicit ReplayView(SDL_Renderer*const renderer, const string& dirPath, const Rect<int>& wallRect, const int cellSize,
+    Reactive<Path>*const currentPath);
+
+  constexpr bool isAnimating() const {
+    return isPlaying;
+  }
+
+  Action reactKeyDown(const SDL_KeyboardEvent&) override;
+  void step(const unsigned int dt) override;
+  void render() override;
+  ~ReplayView();
+};
+
+}  // namespace ii887522::snake
+
+#endif
+#endif  // SNAKE_SRC_MAIN_VIEW_REPLAYVIEW_H_
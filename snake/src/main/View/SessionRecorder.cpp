@@ -0,0 +1,67 @@
+// Copyright ii887522
+
+#ifndef TEST
+
+#include "SessionRecorder.h"
+#include <Any/View.h>
+#include <Struct/Point.h>
+#include <SDL.h>
+#include <string>
+#include <fstream>
+#include <filesystem>
+#include "../Functions/stream_ext.h"
+#include "../Struct/SessionHeader.h"
+#include "../Struct/SessionEvent.h"
+
+using std::string;
+using std::ios;
+using std::filesystem::path;
+using std::filesystem::create_directories;
+using ii887522::viewify::View;
+using ii887522::viewify::Action;
+using ii887522::viewify::Point;
+
+namespace ii887522::snake {
+
+SessionRecorder::SessionRecorder(SDL_Renderer*const renderer, const string& filePath, const unsigned long long seed) :
+  View{ renderer }, time{ 0u } {
+  if (filePath.empty()) return;
+  if (path{ filePath }.has_parent_path()) create_directories(path{ filePath }.parent_path());
+  file.open(filePath, ios::binary | ios::trunc);
+  write(file, SessionHeader{ SessionHeader::MAGIC, SessionHeader::VERSION, seed });
+}
+
+void SessionRecorder::record(const SessionEvent& event) {
+  if (file.is_open()) write(file, event);
+}
+
+Action SessionRecorder::reactKeyDown(const SDL_KeyboardEvent& keyEvent) {
+  record(SessionEvent{ keyEvent.type, time, keyEvent.keysym.sym, Point{ 0, 0 } });
+  return Action::NONE;
+}
+
+Action SessionRecorder::reactKeyUp(const SDL_KeyboardEvent& keyEvent) {
+  record(SessionEvent{ keyEvent.type, time, keyEvent.keysym.sym, Point{ 0, 0 } });
+  return Action::NONE;
+}
+
+void SessionRecorder::reactMouseMotion(const SDL_MouseMotionEvent& motionEvent) {
+  record(SessionEvent{ motionEvent.type, time, 0, Point{ motionEvent.x, motionEvent.y } });
+}
+
+void SessionRecorder::reactMouseButtonDown(const SDL_MouseButtonEvent& buttonEvent) {
+  record(SessionEvent{ buttonEvent.type, time, buttonEvent.button, Point{ buttonEvent.x, buttonEvent.y } });
+}
+
+void SessionRecorder::reactMouseButtonUp(const SDL_MouseButtonEvent& buttonEvent) {
+  record(SessionEvent{ buttonEvent.type, time, buttonEvent.button, Point{ buttonEvent.x, buttonEvent.y } });
+}
+
+void SessionRecorder::step(const unsigned int dt) {
+  time += dt;
+  record(SessionEvent{ SessionEvent::FRAME, time, 0, Point{ 0, 0 } });
+}
+
+}  // namespace ii887522::snake
+
+#endif
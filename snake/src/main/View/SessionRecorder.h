@@ -0,0 +1,57 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_VIEW_SESSIONRECORDER_H_
+#define SNAKE_SRC_MAIN_VIEW_SESSIONRECORDER_H_
+
+#ifndef TEST
+
+#include <Any/View.h>
+#include <SDL.h>
+#include <string>
+#include <fstream>
+#include "../Struct/SessionEvent.h"
+
+using std::string;
+using std::ofstream;
+using ii887522::viewify::View;
+using ii887522::viewify::Action;
+
+namespace ii887522::snake {
+
+// It is an invisible view which records every input received and every frame stepped by the app into a session file, so that the
+// session can be played again exactly as the user did. It must be put before every other view so that it sees every input. The
+// time of the session only advances with the frames stepped, so a session plays the same no matter how long each frame takes.
+// Not Thread Safe: it must only be used in main thread
+// See also ../Struct/SessionHeader.h and ../Any/SessionPlayer.h for more details
+class SessionRecorder final : public View {
+  // remove copy semantics
+  SessionRecorder(const SessionRecorder&) = delete;
+  SessionRecorder& operator=(const SessionRecorder&) = delete;
+
+  // remove move semantics
+  SessionRecorder(SessionRecorder&&) = delete;
+  SessionRecorder& operator=(SessionRecorder&&) = delete;
+
+  ofstream file;
+  unsigned int time;  // in milliseconds since the session began
+
+  void record(const SessionEvent&);
+
+ public:
+  // Param renderer: it must not be assigned to integer
+  // Param filePath: nothing is recorded if it is empty
+  // Param seed: the seed the games are played with
+  explicit SessionRecorder(SDL_Renderer*const renderer, const string& filePath, const unsigned long long seed);
+
+  Action reactKeyDown(const SDL_KeyboardEvent&) override;
+  Action reactKeyUp(const SDL_KeyboardEvent&) override;
+  void reactMouseMotion(const SDL_MouseMotionEvent&) override;
+  void reactMouseButtonDown(const SDL_MouseButtonEvent&) override;
+  void reactMouseButtonUp(const SDL_MouseButtonEvent&) override;
+  void step(const unsigned int dt) override;
+};
+
+}  // namespace ii887522::snake
+
+#endif
+#endif  // SNAKE_SRC_MAIN_VIEW_SESSIONRECORDER_H_
@@ -5,26 +5,37 @@
 #include "Snake.h"
 #include <Any/View.h>
 #include <Struct/Rect.h>
+#include <Struct/Color.h>
 #include <Any/Reactive.h>
-#include <Any/Map.h>
 #include <SDL.h>
 #include <functional>
 #include <random>
 #include <stdexcept>
+#include <vector>
+#include <algorithm>
 #include <Any/Enums.h>
 #include "../Any/Enums.h"
+#include "../Any/CellGrid.h"
+#include "../Any/Canvas.h"
+#include "../Any/MemoryScope.h"
+#include "../Functions/accounting.h"
+#include "BoardView.h"
 
 using std::function;
 using std::default_random_engine;
 using std::runtime_error;
+using std::vector;
+using std::max;
 using ii887522::viewify::Action;
+using ii887522::viewify::Color;
 
 namespace ii887522::snake {
 
 Snake::Builder::Builder(SDL_Renderer*const renderer, const Rect<int>& wallRect, const int cellSize, default_random_engine& randomEngine,
-  Map<CellType>& map, const function<void()>& onHit) : renderer{ renderer }, wallRect{ wallRect }, cellSize{ cellSize },
+  CellGrid& map, const function<void()>& onHit) : renderer{ renderer }, wallRect{ wallRect }, cellSize{ cellSize },
   isDead{ nullptr }, hasSetDead{ false }, randomEngine{ randomEngine }, map{ map }, hasEatFood{ nullptr }, hasSetHasEatFood{ false },
-  onHit{ onHit } { }
+  onHit{ onHit }, onReborn{ []() { } }, onMove{ [](const Direction) { } }, profiler{ nullptr }, board{ nullptr },
+  length{ 0u } { }
 
 Snake* Snake::Builder::build() {
   if (!hasSetDead) throw runtime_error{ "Snake isDead is required!" };
@@ -33,11 +44,75 @@ Snake* Snake::Builder::build() {
 }
 
 Snake::Snake(const Builder& builder) : View{ builder.renderer },
-  model{ builder.wallRect.size, builder.cellSize, builder.randomEngine, builder.map, builder.hasEatFood, builder.onHit },
-  wallPosition{ builder.wallRect.position } {
-  builder.isDead->watch([this](const bool& value, const int) {
+  model{
+    builder.cellSize, builder.randomEngine, builder.map, builder.hasEatFood, builder.onHit, builder.onReborn,
+    builder.onMove, builder.length
+  },
+  wallPosition{ builder.wallRect.position }, profiler{ builder.profiler }, board{ builder.board }, watcherUsage{ 0ll, 0ll } {
+  watchTracked(builder.isDead, [this](const bool& value, const int) {
     model.setDead(value);
+  }, &watcherUsage);
+  if (!board) return;
+  board->addLayer([this](Canvas& canvas, const Point<int>& origin, const SDL_Rect& clip) {
+    const auto& positions{ model.getPositions() };
+    auto drawCallCount{ 0u };
+    for (auto i{ 0u }; i < positions.size(); ) {
+      const auto rect{ getRect(origin, positions[i].get()) };
+      const auto distance{
+        max(max(clip.x - rect.x - rect.w, rect.x - clip.x - clip.w), max(clip.y - rect.y - rect.h, rect.y - clip.y - clip.h))
+      };  // how far the segment is outside the region in pixels
+      if (distance <= 0) {
+        canvas.fillRect(rect, Color{ 0u, 255u, 0u });
+        ++drawCallCount;
+        ++i;
+      } else {
+        // Adjacent segments are never more than 2 cells apart, so the segments right after a segment far away from the region
+        // cannot reach it either
+        i += max(static_cast<unsigned int>(distance / model.getCellSize()) >> 1u, 1u);
+      }
+    }
+    if (profiler) profiler->countDrawCalls(drawCallCount);
   });
+  for (const auto& modelPosition : model.getPositions()) prevPositions.push_back(modelPosition.get());
+}
+
+SDL_Rect Snake::getRect(const Point<int>& origin, const Point<float>& position) const {
+  return SDL_Rect{
+    static_cast<int>(origin.x + position.x * model.getCellSize()), static_cast<int>(origin.y + position.y * model.getCellSize()),
+    model.getCellSize(), model.getCellSize()
+  };
+}
+
+void Snake::damageBoard() {
+  const auto& positions{ model.getPositions() };
+  board->follow(positions.front().get());
+  if (positions.size() != prevPositions.size()) {
+    for (const auto& prevPosition : prevPositions) board->damage(getRect(Point{ 0, 0 }, prevPosition));
+    prevPositions.clear();
+    for (const auto& modelPosition : positions) {
+      board->damage(getRect(Point{ 0, 0 }, modelPosition.get()));
+      prevPositions.push_back(modelPosition.get());
+    }
+    return;
+  }
+  // A segment moving the same way as both of its neighbours stays covered by them, so only the head, the tail and the segments
+  // turning a corner change what is on the board.
+  const auto getDelta{ [&](const unsigned int i) {
+    return Point{ positions[i].get().x - prevPositions[i].x, positions[i].get().y - prevPositions[i].y };
+  } };
+  const auto lastIndex{ static_cast<unsigned int>(positions.size()) - 1u };
+  for (auto i{ 0u }; i != positions.size(); ++i) {
+    const auto delta{ getDelta(i) };
+    if (delta.x == 0.f && delta.y == 0.f) continue;
+    if (i != 0u && i != lastIndex) {
+      const auto prevDelta{ getDelta(i - 1u) };
+      const auto nextDelta{ getDelta(i + 1u) };
+      if (delta.x == prevDelta.x && delta.y == prevDelta.y && delta.x == nextDelta.x && delta.y == nextDelta.y) continue;
+    }
+    board->damage(getRect(Point{ 0, 0 }, prevPositions[i]));
+    board->damage(getRect(Point{ 0, 0 }, positions[i].get()));
+  }
+  for (auto i{ 0u }; i != positions.size(); ++i) prevPositions[i] = positions[i].get();
 }
 
 Action Snake::reactKeyDown(const SDL_KeyboardEvent& keyEvent) {
@@ -47,13 +122,16 @@ Action Snake::reactKeyDown(const SDL_KeyboardEvent& keyEvent) {
 
 void Snake::step(const unsigned int dt) {
   model.step(dt);
+  if (board) damageBoard();
 }
 
 void Snake::checkAndReactHits(const unsigned int dt) {
   model.checkAndReactHits(dt);
+  if (board) damageBoard();
 }
 
 void Snake::render() {
+  if (board) return;
   SDL_SetRenderDrawColor(getRenderer(), 0u, 255u, 0u, 255u);
   for (const auto& modelPosition : model.getPositions()) {
     const SDL_Rect rect{
@@ -62,6 +140,11 @@ void Snake::render() {
     };
     SDL_RenderFillRect(getRenderer(), &rect);
   }
+  if (profiler) profiler->countDrawCalls(static_cast<unsigned int>(model.getPositions().size()));
+}
+
+Snake::~Snake() {
+  trackFree(MemoryCategory::REACTIVE_WATCHERS, watcherUsage);
 }
 
 }  // namespace ii887522::snake
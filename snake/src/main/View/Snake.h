@@ -8,21 +8,25 @@
 #include <Any/View.h>
 #include <Struct/Rect.h>
 #include <Any/Reactive.h>
-#include <Any/Map.h>
 #include <Struct/Point.h>
 #include <SDL.h>
 #include <functional>
 #include <random>
+#include <vector>
 #include <Any/Enums.h>
 #include "../Model/SnakeModel.h"
+#include "../Any/FrameProfiler.h"
 #include "../Any/Enums.h"
+#include "../Any/CellGrid.h"
+#include "../Struct/MemoryUsage.h"
+#include "BoardView.h"
 
 using std::function;
 using std::default_random_engine;
+using std::vector;
 using ii887522::viewify::View;
 using ii887522::viewify::Rect;
 using ii887522::nitro::Reactive;
-using ii887522::viewify::Map;
 using ii887522::viewify::Point;
 using ii887522::viewify::Action;
 
@@ -56,15 +60,20 @@ class Snake final : public View {
     Reactive<bool>* isDead;
     bool hasSetDead;
     default_random_engine& randomEngine;
-    Map<CellType>& map;
+    CellGrid& map;
     Reactive<bool>* hasEatFood;
     bool hasSetHasEatFood;
     const function<void()> onHit;
+    function<void()> onReborn;
+    function<void(Direction)> onMove;
+    FrameProfiler* profiler;
+    BoardView* board;
+    unsigned int length;
 
    public:
     // Param renderer: it must not be assigned to integer
     explicit Builder(SDL_Renderer*const renderer, const Rect<int>& wallRect, const int cellSize, default_random_engine&,
-      Map<CellType>&, const function<void()>& onHit);
+      CellGrid&, const function<void()>& onHit);
 
     // Must Call Time(s): At least 1
     constexpr Builder& setDead(Reactive<bool>*const value) {
@@ -80,6 +89,39 @@ class Snake final : public View {
       return *this;
     }
 
+    // It is called when a new snake is born, before its first move
+    Builder& setOnReborn(const function<void()>& value) {
+      onReborn = value;
+      return *this;
+    }
+
+    // It is called whenever the head starts moving into the next cell
+    Builder& setOnMove(const function<void(Direction)>& value) {
+      onMove = value;
+      return *this;
+    }
+
+    // Param value: draw calls made by the snake are counted into it
+    constexpr Builder& setProfiler(FrameProfiler*const value) {
+      profiler = value;
+      return *this;
+    }
+
+    // Param value: if it is not nullptr, the snake draws itself as a layer of the board and only reports the cells it changes to the
+    // board instead of drawing onto the screen every frame
+    constexpr Builder& setBoard(BoardView*const value) {
+      board = value;
+      return *this;
+    }
+
+    // Param value: the number of segments a new snake is laid with along the serpentine of the map, so that scripted scenarios can
+    //   start from a board as full as they need. If it is not set, a new snake is born with 1 segment in the middle of the map
+    //   heading a random way. See also ../Model/SnakeModel.h for more details
+    constexpr Builder& setLength(const unsigned int value) {
+      length = value;
+      return *this;
+    }
+
     // Must Call Time(s): At least 1
     Snake* build();
 
@@ -89,14 +131,26 @@ class Snake final : public View {
  private:
   SnakeModel model;
   const Point<int> wallPosition;
+  FrameProfiler*const profiler;
+  BoardView*const board;
+  vector<Point<float>> prevPositions;  // the segment positions in cells when the board was last told about changes
+  MemoryUsage watcherUsage;
 
   explicit Snake(const Builder&);
 
+  // Param position: the segment position in cells
+  // Return: the segment rect relative to origin
+  SDL_Rect getRect(const Point<int>& origin, const Point<float>& position) const;
+
+  // It tells the board about the regions changed by segments which moved since the last call.
+  void damageBoard();
+
  public:
   Action reactKeyDown(const SDL_KeyboardEvent&) override;
   void step(const unsigned int dt) override;
   void checkAndReactHits(const unsigned int dt) override;
   void render() override;
+  ~Snake();
 };
 
 }  // namespace ii887522::snake
@@ -0,0 +1,23 @@
+// Copyright ii887522
+
+#ifndef TEST
+
+#include "StartupProbeView.h"
+#include <Any/View.h>
+#include <SDL.h>
+#include "../Any/StartupTimeline.h"
+
+using ii887522::viewify::View;
+
+namespace ii887522::snake {
+
+StartupProbeView::StartupProbeView(SDL_Renderer*const renderer, StartupTimeline*const timeline) : View{ renderer },
+  timeline{ *timeline } { }
+
+void StartupProbeView::render() {
+  timeline.finish();
+}
+
+}  // namespace ii887522::snake
+
+#endif
@@ -0,0 +1,41 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_VIEW_STARTUPPROBEVIEW_H_
+#define SNAKE_SRC_MAIN_VIEW_STARTUPPROBEVIEW_H_
+
+#ifndef TEST
+
+#include <Any/View.h>
+#include <SDL.h>
+#include "../Any/StartupTimeline.h"
+
+using ii887522::viewify::View;
+
+namespace ii887522::snake {
+
+// It is an invisible view which finishes the startup timeline given when the first frame is rendered. It must be put after every
+// other view so that the whole first frame is measured.
+// Not Thread Safe: it must only be used in main thread
+// See also ../Any/StartupTimeline.h for more details
+class StartupProbeView final : public View {
+  // remove copy semantics
+  StartupProbeView(const StartupProbeView&) = delete;
+  StartupProbeView& operator=(const StartupProbeView&) = delete;
+
+  // remove move semantics
+  StartupProbeView(StartupProbeView&&) = delete;
+  StartupProbeView& operator=(StartupProbeView&&) = delete;
+
+  StartupTimeline& timeline;
+
+ public:
+  // Param renderer: it must not be assigned to integer
+  explicit StartupProbeView(SDL_Renderer*const renderer, StartupTimeline*const timeline);
+
+  void render() override;
+};
+
+}  // namespace ii887522::snake
+
+#endif
+#endif  // SNAKE_SRC_MAIN_VIEW_STARTUPPROBEVIEW_H_
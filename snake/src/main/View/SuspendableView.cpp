@@ -0,0 +1,66 @@
+// Copyright ii887522
+
+#ifndef TEST
+
+#include "SuspendableView.h"
+#include <Any/View.h>
+#include <SDL.h>
+#include <functional>
+
+using std::function;
+using ii887522::viewify::View;
+using ii887522::viewify::Action;
+
+namespace ii887522::snake {
+
+SuspendableView::SuspendableView(SDL_Renderer*const renderer, View*const view, const function<bool()>& isActive,
+  const function<void()>& onResume) : View{ renderer }, view{ view }, isActive{ isActive }, onResume{ onResume },
+  isSuspended{ false } { }
+
+Action SuspendableView::reactKeyDown(const SDL_KeyboardEvent& keyEvent) {
+  return view->reactKeyDown(keyEvent);
+}
+
+Action SuspendableView::reactKeyUp(const SDL_KeyboardEvent& keyEvent) {
+  return view->reactKeyUp(keyEvent);
+}
+
+void SuspendableView::reactMouseMotion(const SDL_MouseMotionEvent& motionEvent) {
+  view->reactMouseMotion(motionEvent);
+}
+
+void SuspendableView::reactMouseButtonDown(const SDL_MouseButtonEvent& buttonEvent) {
+  view->reactMouseButtonDown(buttonEvent);
+}
+
+void SuspendableView::reactMouseButtonUp(const SDL_MouseButtonEvent& buttonEvent) {
+  view->reactMouseButtonUp(buttonEvent);
+}
+
+void SuspendableView::step(const unsigned int dt) {
+  if (!isActive()) {
+    isSuspended = true;
+    return;
+  }
+  if (isSuspended) {
+    onResume();
+    isSuspended = false;
+  }
+  view->step(dt);
+}
+
+void SuspendableView::checkAndReactHits(const unsigned int dt) {
+  if (!isSuspended) view->checkAndReactHits(dt);
+}
+
+void SuspendableView::render() {
+  if (!isSuspended) view->render();
+}
+
+SuspendableView::~SuspendableView() {
+  delete view;
+}
+
+}  // namespace ii887522::snake
+
+#endif
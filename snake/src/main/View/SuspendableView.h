@@ -0,0 +1,60 @@
+// Copyright ii887522
+
+#ifndef SNAKE_SRC_MAIN_VIEW_SUSPENDABLEVIEW_H_
+#define SNAKE_SRC_MAIN_VIEW_SUSPENDABLEVIEW_H_
+
+#ifndef TEST
+
+#include <Any/View.h>
+#include <SDL.h>
+#include <functional>
+
+using std::function;
+using ii887522::viewify::View;
+using ii887522::viewify::Action;
+
+namespace ii887522::snake {
+
+// It wraps a view which has nothing to show most of the time, such as a page which is not the current one, and neither steps nor
+// renders it while it is inactive, so that none of its views are visited at all. Inputs are still passed to it, since they may
+// make it active. The view is only stepped by the time of the frames it is active in, so its timers and animations carry on from
+// where they were suspended rather than jumping ahead by the time it has been inactive.
+// Not Thread Safe: it must only be used in main thread
+class SuspendableView final : public View {
+  // remove copy semantics
+  SuspendableView(const SuspendableView&) = delete;
+  SuspendableView& operator=(const SuspendableView&) = delete;
+
+  // remove move semantics
+  SuspendableView(SuspendableView&&) = delete;
+  SuspendableView& operator=(SuspendableView&&) = delete;
+
+  View*const view;
+  const function<bool()> isActive;
+  const function<void()> onResume;
+  bool isSuspended;
+
+ public:
+  // Param renderer: it must not be assigned to integer
+  // Param view: it must not be assigned to integer. It will be owned by this view.
+  // Param isActive: it tells whether the view has anything to show
+  // Param onResume: it is called before the view is stepped again after it has been suspended, such as to restart a wall clock
+  //   which must not count the time suspended
+  explicit SuspendableView(SDL_Renderer*const renderer, View*const view, const function<bool()>& isActive,
+    const function<void()>& onResume = []() { });
+
+  Action reactKeyDown(const SDL_KeyboardEvent&) override;
+  Action reactKeyUp(const SDL_KeyboardEvent&) override;
+  void reactMouseMotion(const SDL_MouseMotionEvent&) override;
+  void reactMouseButtonDown(const SDL_MouseButtonEvent&) override;
+  void reactMouseButtonUp(const SDL_MouseButtonEvent&) override;
+  void step(const unsigned int dt) override;
+  void checkAndReactHits(const unsigned int dt) override;
+  void render() override;
+  ~SuspendableView();
+};
+
+}  // namespace ii887522::snake
+
+#endif
+#endif  // SNAKE_SRC_MAIN_VIEW_SUSPENDABLEVIEW_H_